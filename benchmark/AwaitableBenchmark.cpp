@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <awaitable_ringbuffer.hpp>
+#include "TestType.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+#include <atomic>
+
+using AwaitableQueue = awaitable_ringbuffer<Type, 64>;
+
+static ringbuffer_detached_task awaitable_producer(AwaitableQueue& queue,
+                                                   ringbuffer_executor& executor,
+                                                   std::int64_t count)
+{
+    co_await executor.schedule();
+
+    for (std::int64_t i = 0; i < count; ++i)
+    {
+        co_await queue.push(TEST_VALUE, executor);
+    }
+}
+
+static ringbuffer_detached_task awaitable_consumer(AwaitableQueue& queue,
+                                                   ringbuffer_executor& executor,
+                                                   std::int64_t count,
+                                                   std::atomic<bool>& done)
+{
+    co_await executor.schedule();
+
+    for (std::int64_t i = 0; i < count; ++i)
+    {
+        benchmark::DoNotOptimize(co_await queue.pop(executor));
+    }
+
+    done = true;
+}
+
+static void awaitable_single_thread(benchmark::State& state)
+{
+    ringbuffer_single_thread_executor executor;
+    AwaitableQueue queue;
+
+    for (auto _ : state)
+    {
+        std::atomic<bool> done(false);
+
+        awaitable_consumer(queue, executor, state.range(0), done);
+        awaitable_producer(queue, executor, state.range(0));
+
+        executor.run();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void awaitable_thread_pool(benchmark::State& state)
+{
+    ringbuffer_thread_pool pool(2);
+    AwaitableQueue queue;
+
+    for (auto _ : state)
+    {
+        std::atomic<bool> done(false);
+
+        awaitable_consumer(queue, pool, state.range(0), done);
+        awaitable_producer(queue, pool, state.range(0));
+
+        while (!done)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(awaitable_single_thread)
+    ->Range(1 << 10, 1 << 16);
+
+BENCHMARK(awaitable_thread_pool)
+    ->Range(1 << 10, 1 << 16)
+    ->UseRealTime();
+
+#endif
@@ -0,0 +1,220 @@
+#include <benchmark/benchmark.h>
+#include <combining_ringbuffer.hpp>
+#include "TestType.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Bounded lock-free MPMC queue (Vyukov), used
+ * as CAS based baseline.
+ */
+template<typename T, std::size_t Size>
+class mpmc_baseline
+{
+    struct cell
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+public:
+    mpmc_baseline() :
+        m_cells(new cell[Size]),
+        m_tail(0),
+        m_head(0)
+    {
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push_back(const T& value)
+    {
+        auto position = m_tail.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            auto& current = m_cells[position % Size];
+            auto sequence = current.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+            if (difference == 0)
+            {
+                if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    current.value = value;
+                    current.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<typename Function>
+    std::size_t drain(Function function, std::size_t batch)
+    {
+        std::size_t result = 0;
+
+        while (result < batch)
+        {
+            auto position = m_head.load(std::memory_order_relaxed);
+            auto& current = m_cells[position % Size];
+
+            if (current.sequence.load(std::memory_order_acquire) != position + 1)
+            {
+                break;
+            }
+
+            // Single consumer, so head isn't contended
+            function(current.value);
+            current.sequence.store(position + Size, std::memory_order_release);
+            m_head.store(position + 1, std::memory_order_relaxed);
+            ++result;
+        }
+
+        return result;
+    }
+
+private:
+    std::unique_ptr<cell[]> m_cells;
+    alignas(64) std::atomic<std::size_t> m_tail;
+    alignas(64) std::atomic<std::size_t> m_head;
+};
+
+/**
+ * @brief Ringbuffer behind mutex.
+ */
+template<typename T, std::size_t Size>
+class mutex_baseline
+{
+public:
+    bool push_back(const T& value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_buffer.push_back(value);
+
+        return true;
+    }
+
+    template<typename Function>
+    std::size_t drain(Function function, std::size_t batch)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto count = std::min(batch, m_buffer.size());
+
+        m_buffer.view().subspan(0, count).for_each(function);
+        m_buffer.pop_front(count);
+
+        return count;
+    }
+
+private:
+    std::mutex m_mutex;
+    ringbuffer<T, Size> m_buffer;
+};
+
+/**
+ * @brief Combining ringbuffer with baseline interface.
+ */
+template<typename T, std::size_t Size>
+class combining_adapter : public combining_ringbuffer<T, Size>
+{
+public:
+    bool push_back(const T& value)
+    {
+        combining_ringbuffer<T, Size>::push_back(value);
+
+        return true;
+    }
+};
+
+static constexpr std::size_t CombiningSize = 1 << 14;
+
+// Every producer count runs with one draining consumer.
+// MPMC queue rejects values, when consumer falls behind,
+// so only accepted values are counted
+template<typename Queue>
+static void producers_push_back(benchmark::State& state)
+{
+    static std::unique_ptr<Queue> queue;
+    static std::atomic<bool> consuming(false);
+    static std::thread consumer;
+
+    if (state.thread_index() == 0)
+    {
+        queue.reset(new Queue());
+        consuming = true;
+        consumer = std::thread([]()
+        {
+            while (consuming)
+            {
+                if (queue->drain([](Type& el) { benchmark::DoNotOptimize(el); }, 256) == 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::int64_t rejected = 0;
+
+    for (auto _ : state)
+    {
+        if (!queue->push_back(TEST_VALUE))
+        {
+            ++rejected;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() - rejected);
+
+    if (state.thread_index() == 0)
+    {
+        consuming = false;
+        consumer.join();
+    }
+
+    // Thread counters are summed
+    state.counters["dropped"] = static_cast<double>(rejected);
+}
+
+static void combining_producers(benchmark::State& state)
+{
+    producers_push_back<combining_adapter<Type, CombiningSize>>(state);
+}
+
+static void mutex_producers(benchmark::State& state)
+{
+    producers_push_back<mutex_baseline<Type, CombiningSize>>(state);
+}
+
+static void mpmc_producers(benchmark::State& state)
+{
+    producers_push_back<mpmc_baseline<Type, CombiningSize>>(state);
+}
+
+BENCHMARK(combining_producers)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+BENCHMARK(mutex_producers)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+BENCHMARK(mpmc_producers)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include <compressed_ringbuffer.hpp>
+#include "TestType.hpp"
+#include "bench_extend/TemplateFunctionBenchmark.hpp"
+
+static constexpr std::size_t CompressedBlockSize = 128;
+
+static Type timestamp_value(std::size_t i)
+{
+    return Type(1500000000000000ull) + i * 1000 + (i * 7919) % 13;
+}
+
+template<std::size_t N>
+static void compressed_push_back_full(benchmark::State& state)
+{
+    compressed_ringbuffer<Type, N / CompressedBlockSize, CompressedBlockSize> buffer;
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            buffer.push_back(timestamp_value(i));
+        }
+
+        state.PauseTiming();
+
+        buffer.clear();
+
+        state.ResumeTiming();
+    }
+
+    state.counters["bytes"] = static_cast<double>(buffer.memory_usage());
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void compressed_iterating_iterators(benchmark::State& state)
+{
+    compressed_ringbuffer<Type, N / CompressedBlockSize, CompressedBlockSize> buffer;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer.push_back(timestamp_value(i));
+    }
+
+    for (auto _ : state)
+    {
+        for (auto el : buffer)
+        {
+            benchmark::DoNotOptimize(el);
+        }
+    }
+
+    state.counters["bytes"] = static_cast<double>(buffer.memory_usage());
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void compressed_iterating_for_each(benchmark::State& state)
+{
+    compressed_ringbuffer<Type, N / CompressedBlockSize, CompressedBlockSize> buffer;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer.push_back(timestamp_value(i));
+    }
+
+    for (auto _ : state)
+    {
+        Type sum = 0;
+
+        buffer.for_each([&sum](Type el) { sum += el; });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.counters["bytes"] = static_cast<double>(buffer.memory_usage());
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void raw_iterating_sum(benchmark::State& state)
+{
+    ringbuffer<Type, N> buffer;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer.push_back(timestamp_value(i));
+    }
+
+    for (auto _ : state)
+    {
+        Type sum = 0;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            sum += buffer[i];
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.counters["bytes"] = static_cast<double>(sizeof(buffer));
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+BENCHMARK_TEMPLATE_RANGE(compressed_push_back_full)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(compressed_iterating_iterators)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(compressed_iterating_for_each)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(raw_iterating_sum)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include "TestType.hpp"
+#include "bench_extend/TemplateFunctionBenchmark.hpp"
+
+#include <memory>
+
+template<std::size_t N>
+static void fill_orders(ringbuffer<Type, N>& buffer)
+{
+    buffer.clear();
+
+    // Starting from the middle, so window is wrapped
+    for (std::size_t i = 0; i < N / 2; ++i)
+    {
+        buffer.push_back(0);
+        buffer.pop_front();
+    }
+
+    for (Type i = 0; i < N; ++i)
+    {
+        buffer.push_back(i);
+    }
+}
+
+static bool is_cancelled(Type order)
+{
+    return order % 7 == 0;
+}
+
+template<std::size_t N>
+static void remove_if_cancelled(benchmark::State& state)
+{
+    std::unique_ptr<ringbuffer<Type, N>> buffer(new ringbuffer<Type, N>());
+
+    for (auto _ : state)
+    {
+        fill_orders(*buffer);
+
+        benchmark::DoNotOptimize(buffer->remove_if(is_cancelled));
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void erase_each_cancelled(benchmark::State& state)
+{
+    std::unique_ptr<ringbuffer<Type, N>> buffer(new ringbuffer<Type, N>());
+
+    for (auto _ : state)
+    {
+        fill_orders(*buffer);
+
+        for (std::size_t i = 0; i < buffer->size();)
+        {
+            if (is_cancelled((*buffer)[i]))
+            {
+                buffer->erase(buffer->begin() + i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        benchmark::DoNotOptimize(buffer->size());
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void erase_front_range(benchmark::State& state)
+{
+    std::unique_ptr<ringbuffer<Type, N>> buffer(new ringbuffer<Type, N>());
+
+    for (auto _ : state)
+    {
+        fill_orders(*buffer);
+
+        // Only front quarter is shifted
+        buffer->erase(buffer->begin() + N / 4, buffer->begin() + N / 2);
+
+        benchmark::DoNotOptimize(buffer->size());
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+BENCHMARK_TEMPLATE_RANGE(remove_if_cancelled)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(erase_each_cancelled)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(erase_front_range)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
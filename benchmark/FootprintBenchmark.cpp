@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include "bench_extend/TemplateFunctionBenchmark.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using SmallRing = ringbuffer<std::uint32_t, 16>;
+
+static void footprint_counters(benchmark::State& state, std::size_t instances)
+{
+    state.counters["sizeof"] = sizeof(SmallRing);
+    state.counters["payload"] = 16 * sizeof(std::uint32_t);
+    state.counters["bytes"] = static_cast<double>(instances * sizeof(SmallRing));
+}
+
+template<std::size_t N>
+static void small_rings_push_back(benchmark::State& state)
+{
+    std::vector<SmallRing> rings(N);
+
+    std::uint32_t value = 0;
+
+    for (auto _ : state)
+    {
+        for (auto&& ring : rings)
+        {
+            ring.push_back(value++);
+        }
+    }
+
+    footprint_counters(state, N);
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void small_rings_sum(benchmark::State& state)
+{
+    std::vector<SmallRing> rings(N);
+
+    for (auto&& ring : rings)
+    {
+        for (std::uint32_t i = 0; i < 20; ++i)
+        {
+            ring.push_back(i);
+        }
+    }
+
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+
+        for (auto&& ring : rings)
+        {
+            for (std::size_t i = 0; i < ring.size(); ++i)
+            {
+                sum += ring[i];
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    footprint_counters(state, N);
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+BENCHMARK_TEMPLATE_RANGE(small_rings_push_back)
+    ->TemplateRange<1 << 9, 1 << 18>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(small_rings_sum)
+    ->TemplateRange<1 << 9, 1 << 18>()
+    ->Complexity();
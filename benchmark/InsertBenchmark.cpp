@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include "TestType.hpp"
+#include "bench_extend/TemplateFunctionBenchmark.hpp"
+
+#include <memory>
+
+template<std::size_t N>
+static void insert_near_front(benchmark::State& state)
+{
+    std::unique_ptr<ringbuffer<Type, N>> buffer(new ringbuffer<Type, N>());
+
+    for (std::size_t i = 0; i < N - 1; ++i)
+    {
+        buffer->push_back(TEST_VALUE);
+    }
+
+    for (auto _ : state)
+    {
+        buffer->insert(buffer->begin() + 8, TEST_VALUE);
+        buffer->pop_front();
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void insert_middle(benchmark::State& state)
+{
+    std::unique_ptr<ringbuffer<Type, N>> buffer(new ringbuffer<Type, N>());
+
+    for (std::size_t i = 0; i < N - 1; ++i)
+    {
+        buffer->push_back(TEST_VALUE);
+    }
+
+    for (auto _ : state)
+    {
+        buffer->insert(buffer->begin() + N / 2, TEST_VALUE);
+        buffer->pop_back();
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void push_front_overwrite(benchmark::State& state)
+{
+    std::unique_ptr<ringbuffer<Type, N>> buffer(new ringbuffer<Type, N>());
+
+    for (auto _ : state)
+    {
+        buffer->push_front(TEST_VALUE);
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+BENCHMARK_TEMPLATE_RANGE(insert_near_front)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(insert_middle)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(push_front_overwrite)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
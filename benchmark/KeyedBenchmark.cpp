@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include <keyed_ringbuffer.hpp>
+#include "TestType.hpp"
+#include "bench_extend/TemplateFunctionBenchmark.hpp"
+
+#include <algorithm>
+#include <memory>
+
+template<std::size_t N>
+static void keyed_push_contains(benchmark::State& state)
+{
+    std::unique_ptr<keyed_ringbuffer<Type, N>> buffer(new keyed_ringbuffer<Type, N>());
+
+    Type key = 0;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer->push_back(key++);
+    }
+
+    for (auto _ : state)
+    {
+        // Half of lookups miss
+        benchmark::DoNotOptimize(buffer->contains(key - N / 2 - (key & 1) * N));
+
+        buffer->push_back(key++);
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void linear_push_contains(benchmark::State& state)
+{
+    std::unique_ptr<ringbuffer<Type, N>> buffer(new ringbuffer<Type, N>());
+
+    Type key = 0;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer->push_back(key++);
+    }
+
+    for (auto _ : state)
+    {
+        auto probe = key - N / 2 - (key & 1) * N;
+
+        benchmark::DoNotOptimize(std::find(buffer->begin(), buffer->end(), probe) != buffer->end());
+
+        buffer->push_back(key++);
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+BENCHMARK_TEMPLATE_RANGE(keyed_push_contains)
+    ->TemplateRange<1, 1 << 18>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(linear_push_contains)
+    ->TemplateRange<1, 1 << 18>()
+    ->Complexity();
@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include <async_ringbuffer_logger.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+struct BenchmarkLogRecord
+{
+    std::uint64_t timestamp;
+    std::uint32_t thread;
+    std::uint32_t level;
+    std::uint64_t id;
+    double latency;
+};
+
+struct BenchmarkLogFormatter
+{
+    void operator()(const BenchmarkLogRecord& record, std::string& output) const
+    {
+        char line[128];
+
+        auto length = std::snprintf(line, sizeof(line),
+                                    "%llu INFO [worker-%u] request id=%llu latency=%.3fms\n",
+                                    static_cast<unsigned long long>(record.timestamp),
+                                    record.thread,
+                                    static_cast<unsigned long long>(record.id),
+                                    record.latency);
+
+        output.append(line, static_cast<std::size_t>(length));
+    }
+};
+
+using BenchmarkLogger = async_ringbuffer_logger<
+    BenchmarkLogRecord,
+    1 << 14,
+    BenchmarkLogFormatter,
+    ringbuffer_fd_sink
+>;
+
+static BenchmarkLogger* sharedLogger = nullptr;
+static int sharedLoggerFd = -1;
+
+static void async_logger_log(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        ringbuffer_logger_options options;
+        options.overflow = ringbuffer_overflow_policy::block;
+
+        sharedLoggerFd = open("/dev/null", O_WRONLY);
+        sharedLogger = new BenchmarkLogger(BenchmarkLogFormatter(), ringbuffer_fd_sink(sharedLoggerFd), options);
+    }
+
+    std::uint64_t id = 0;
+
+    for (auto _ : state)
+    {
+        sharedLogger->log(BenchmarkLogRecord{id, static_cast<std::uint32_t>(state.thread_index()), 0, id, id * 0.001});
+        ++id;
+    }
+
+    if (state.thread_index() == 0)
+    {
+        // Sustained rate includes draining the queue
+        delete sharedLogger;
+        close(sharedLoggerFd);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static std::FILE* sharedFile = nullptr;
+
+static void fprintf_log(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        sharedFile = std::fopen("/dev/null", "w");
+    }
+
+    std::uint64_t id = 0;
+
+    for (auto _ : state)
+    {
+        std::fprintf(sharedFile,
+                     "%llu INFO [worker-%u] request id=%llu latency=%.3fms\n",
+                     static_cast<unsigned long long>(id),
+                     static_cast<unsigned>(state.thread_index()),
+                     static_cast<unsigned long long>(id),
+                     id * 0.001);
+        ++id;
+    }
+
+    if (state.thread_index() == 0)
+    {
+        std::fclose(sharedFile);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(async_logger_log)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
+
+BENCHMARK(fprintf_log)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
@@ -0,0 +1,190 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include <mapped_ringbuffer.hpp>
+#include "TestType.hpp"
+#include "bench_extend/TemplateFunctionBenchmark.hpp"
+
+template<std::size_t N>
+static mapped_ringbuffer_ptr<ringbuffer<Type, N>> mapped_buffer(bool hugePages,
+                                                               benchmark::State& state)
+{
+    ringbuffer_mapping_options options;
+    options.huge_pages = hugePages;
+    options.prefault = true;
+
+    auto buffer = make_mapped_ringbuffer<ringbuffer<Type, N>>(options);
+
+    state.counters["hugetlb"] = buffer.get_deleter().explicit_huge_pages();
+    state.counters["thp"] = buffer.get_deleter().transparent_huge_pages();
+
+    return buffer;
+}
+
+template<std::size_t N, bool HugePages>
+static void mapped_push_back_full(benchmark::State& state)
+{
+    auto buffer = mapped_buffer<N>(HugePages, state);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            buffer->push_back(TEST_VALUE);
+        }
+
+        state.PauseTiming();
+
+        buffer->clear();
+
+        state.ResumeTiming();
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N, bool HugePages>
+static void mapped_iterating_index(benchmark::State& state)
+{
+    auto buffer = mapped_buffer<N>(HugePages, state);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer->push_back(TEST_VALUE);
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            benchmark::DoNotOptimize((*buffer)[i]);
+        }
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N, bool HugePages>
+static void mapped_iterating_at(benchmark::State& state)
+{
+    auto buffer = mapped_buffer<N>(HugePages, state);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer->push_back(TEST_VALUE);
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            benchmark::DoNotOptimize(buffer->at(i));
+        }
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N, bool HugePages>
+static void mapped_iterating_iterators(benchmark::State& state)
+{
+    auto buffer = mapped_buffer<N>(HugePages, state);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer->push_back(TEST_VALUE);
+    }
+
+    for (auto _ : state)
+    {
+        for (auto&& el : *buffer)
+        {
+            benchmark::DoNotOptimize(el);
+        }
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void push_back_full_4k(benchmark::State& state)
+{
+    mapped_push_back_full<N, false>(state);
+}
+
+template<std::size_t N>
+static void push_back_full_2m(benchmark::State& state)
+{
+    mapped_push_back_full<N, true>(state);
+}
+
+template<std::size_t N>
+static void iterating_index_4k(benchmark::State& state)
+{
+    mapped_iterating_index<N, false>(state);
+}
+
+template<std::size_t N>
+static void iterating_index_2m(benchmark::State& state)
+{
+    mapped_iterating_index<N, true>(state);
+}
+
+template<std::size_t N>
+static void iterating_at_4k(benchmark::State& state)
+{
+    mapped_iterating_at<N, false>(state);
+}
+
+template<std::size_t N>
+static void iterating_at_2m(benchmark::State& state)
+{
+    mapped_iterating_at<N, true>(state);
+}
+
+template<std::size_t N>
+static void iterating_iterators_4k(benchmark::State& state)
+{
+    mapped_iterating_iterators<N, false>(state);
+}
+
+template<std::size_t N>
+static void iterating_iterators_2m(benchmark::State& state)
+{
+    mapped_iterating_iterators<N, true>(state);
+}
+
+BENCHMARK_TEMPLATE_RANGE(push_back_full_4k)
+    ->TemplateRange<1 << 15, 1 << 21>()
+    ->PerfCounters()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(push_back_full_2m)
+    ->TemplateRange<1 << 15, 1 << 21>()
+    ->PerfCounters()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(iterating_index_4k)
+    ->TemplateRange<1 << 15, 1 << 21>()
+    ->PerfCounters()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(iterating_index_2m)
+    ->TemplateRange<1 << 15, 1 << 21>()
+    ->PerfCounters()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(iterating_at_4k)
+    ->TemplateRange<1 << 15, 1 << 21>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(iterating_at_2m)
+    ->TemplateRange<1 << 15, 1 << 21>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(iterating_iterators_4k)
+    ->TemplateRange<1 << 15, 1 << 21>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(iterating_iterators_2m)
+    ->TemplateRange<1 << 15, 1 << 21>()
+    ->Complexity();
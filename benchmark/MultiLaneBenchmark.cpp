@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+#include <multi_lane_ringbuffer.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+struct lane_message
+{
+    std::uint64_t stamp; // 0 for bulk messages
+    std::uint64_t payload;
+};
+
+static constexpr std::size_t LaneQueueSize = 1 << 12;
+static constexpr std::size_t BulkPerRound = 65;
+static constexpr std::size_t TakenPerRound = 64;
+
+static std::uint64_t lane_now()
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+/**
+ * @brief Latency statistics of control messages.
+ */
+struct control_latency
+{
+    control_latency() :
+        total(0),
+        received(0),
+        sent(0)
+    {
+
+    }
+
+    void take(const lane_message& message)
+    {
+        benchmark::DoNotOptimize(message.payload);
+
+        if (message.stamp != 0)
+        {
+            total += lane_now() - message.stamp;
+            ++received;
+        }
+    }
+
+    void report(benchmark::State& state) const
+    {
+        state.counters["control_latency_ns"] = received == 0 ? 0.0 : static_cast<double>(total) / received;
+        state.counters["control_not_taken"] = static_cast<double>(sent - received);
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * TakenPerRound));
+    }
+
+    std::uint64_t total;
+    std::uint64_t received;
+    std::uint64_t sent;
+};
+
+// Every round producer pushes more bulk messages than
+// consumer takes, so bulk traffic saturates queue, and
+// one control message. In single ring control message
+// waits behind whole bulk backlog (or is overwritten),
+// lanes let it bypass backlog.
+static void single_ring_control_latency(benchmark::State& state)
+{
+    static ringbuffer<lane_message, LaneQueueSize> queue;
+
+    queue.clear();
+    control_latency latency;
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < BulkPerRound; ++i)
+        {
+            queue.push_back({0, i});
+        }
+
+        queue.push_back({lane_now(), 0});
+        ++latency.sent;
+
+        for (std::size_t i = 0; i < TakenPerRound; ++i)
+        {
+            latency.take(queue.front());
+            queue.pop_front();
+        }
+    }
+
+    latency.report(state);
+}
+
+template<ringbuffer_lane_policy Policy>
+static void lanes_control_latency(benchmark::State& state)
+{
+    using queue_type = multi_lane_ringbuffer<lane_message, LaneQueueSize, 2>;
+
+    // Bulk lane gets larger share, so round robin
+    // takes it in runs
+    static queue_type queue(Policy, {{1, 32}});
+
+    queue.clear();
+    control_latency latency;
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < BulkPerRound; ++i)
+        {
+            queue.push_back(1, {0, i});
+        }
+
+        queue.push_back(0, {lane_now(), 0});
+        ++latency.sent;
+
+        queue.drain([&latency](std::size_t, lane_message& message) { latency.take(message); }, TakenPerRound);
+    }
+
+    latency.report(state);
+}
+
+static void strict_lanes_control_latency(benchmark::State& state)
+{
+    lanes_control_latency<ringbuffer_lane_policy::strict_priority>(state);
+}
+
+static void drr_lanes_control_latency(benchmark::State& state)
+{
+    lanes_control_latency<ringbuffer_lane_policy::deficit_round_robin>(state);
+}
+
+BENCHMARK(single_ring_control_latency);
+
+BENCHMARK(strict_lanes_control_latency);
+
+BENCHMARK(drr_lanes_control_latency);
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include <order_statistics_ringbuffer.hpp>
+#include "TestType.hpp"
+#include "bench_extend/TemplateFunctionBenchmark.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template<std::size_t N>
+static void order_statistics_push_p99(benchmark::State& state)
+{
+    order_statistics_ringbuffer<Type, N> buffer;
+    std::mt19937_64 random(42);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer.push_back(random() % 100000);
+    }
+
+    for (auto _ : state)
+    {
+        buffer.push_back(random() % 100000);
+
+        benchmark::DoNotOptimize(buffer.percentile(0.99));
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void nth_element_push_p99(benchmark::State& state)
+{
+    ringbuffer<Type, N> buffer;
+    std::mt19937_64 random(42);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        buffer.push_back(random() % 100000);
+    }
+
+    for (auto _ : state)
+    {
+        buffer.push_back(random() % 100000);
+
+        std::vector<Type> copy(buffer.begin(), buffer.end());
+
+        auto nth = copy.begin() + static_cast<std::ptrdiff_t>(0.99 * (copy.size() - 1) + 0.5);
+        std::nth_element(copy.begin(), nth, copy.end());
+
+        benchmark::DoNotOptimize(*nth);
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+BENCHMARK_TEMPLATE_RANGE(order_statistics_push_p99)
+    ->TemplateRange<1, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(nth_element_push_p99)
+    ->TemplateRange<1, 1 << 15>()
+    ->Complexity();
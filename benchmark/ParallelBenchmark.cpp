@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer_parallel.hpp>
+#include "TestType.hpp"
+
+#include <memory>
+
+using parallel_buffer = ringbuffer<Type, 1 << 22>;
+
+// Filled once and wrapped, so traversal crosses wrap point
+static parallel_buffer& parallel_source()
+{
+    static std::unique_ptr<parallel_buffer> buffer;
+
+    if (!buffer)
+    {
+        buffer.reset(new parallel_buffer());
+
+        for (std::size_t i = 0; i < buffer->max_size() + buffer->max_size() / 3; ++i)
+        {
+            buffer->push_back(static_cast<Type>(i));
+        }
+    }
+
+    return *buffer;
+}
+
+static void serial_reduce(benchmark::State& state)
+{
+    auto& buffer = parallel_source();
+
+    for (auto _ : state)
+    {
+        Type sum = 0;
+
+        for (auto&& el : buffer)
+        {
+            sum += el;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+
+static void pool_reduce(benchmark::State& state)
+{
+    auto& buffer = parallel_source();
+    ringbuffer_parallel_pool pool(static_cast<std::size_t>(state.range(0)));
+
+    auto add = [](Type sum, Type el) { return sum + el; };
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parallel_reduce(buffer, Type(0), add, add, pool));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+
+static void pool_for_each(benchmark::State& state)
+{
+    auto& buffer = parallel_source();
+    ringbuffer_parallel_pool pool(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        parallel_for_each(buffer, [](Type& el) { el ^= TEST_VALUE; }, pool);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+
+BENCHMARK(serial_reduce)->UseRealTime();
+
+BENCHMARK(pool_reduce)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+BENCHMARK(pool_for_each)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+static std::uint64_t recycleAllocations = 0;
+
+/**
+ * @brief Allocator, that counts allocations of payloads.
+ */
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&)
+    {
+
+    }
+
+    T* allocate(std::size_t n)
+    {
+        ++recycleAllocations;
+
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* pointer, std::size_t n)
+    {
+        std::allocator<T>().deallocate(pointer, n);
+    }
+
+    template<typename U>
+    bool operator==(const counting_allocator<U>&) const
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const counting_allocator<U>&) const
+    {
+        return false;
+    }
+};
+
+using payload = std::vector<std::uint8_t, counting_allocator<std::uint8_t>>;
+
+// Payload sizes are precomputed, so both variants see same load
+static const std::vector<std::size_t>& payload_sizes()
+{
+    static const auto sizes = []()
+    {
+        std::mt19937 random(42);
+        std::vector<std::size_t> result(4096);
+
+        for (auto&& size : result)
+        {
+            size = 16 + random() % 1024;
+        }
+
+        return result;
+    }();
+
+    return sizes;
+}
+
+static void copy_push_pop(benchmark::State& state)
+{
+    static ringbuffer<payload, 1 << 9> buffer;
+
+    auto& sizes = payload_sizes();
+    std::size_t index = 0;
+    payload source;
+    payload taken;
+
+    auto allocations = recycleAllocations;
+
+    for (auto _ : state)
+    {
+        // Producer builds message, consumer takes it
+        source.assign(sizes[index++ % sizes.size()], 7);
+        buffer.push_back(source);
+
+        taken = std::move(buffer.front());
+        buffer.pop_front();
+
+        benchmark::DoNotOptimize(taken.data());
+    }
+
+    state.counters["allocations"] = benchmark::Counter(
+        static_cast<double>(recycleAllocations - allocations),
+        benchmark::Counter::kAvgIterations
+    );
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void recycle_push_pop(benchmark::State& state)
+{
+    static ringbuffer<payload, 1 << 9> buffer;
+
+    auto& sizes = payload_sizes();
+    std::size_t index = 0;
+    payload taken;
+
+    auto allocations = recycleAllocations;
+
+    for (auto _ : state)
+    {
+        auto size = sizes[index++ % sizes.size()];
+
+        buffer.refill_back([size](payload& slot) { slot.assign(size, 7); });
+        buffer.take_front(taken);
+
+        benchmark::DoNotOptimize(taken.data());
+    }
+
+    state.counters["allocations"] = benchmark::Counter(
+        static_cast<double>(recycleAllocations - allocations),
+        benchmark::Counter::kAvgIterations
+    );
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(copy_push_pop);
+
+BENCHMARK(recycle_push_pop);
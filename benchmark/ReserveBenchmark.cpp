@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <spsc_ringbuffer.hpp>
+
+#include <cstdint>
+
+struct DecodedRecord
+{
+    std::uint64_t timestamp;
+    std::uint64_t id;
+    std::uint32_t price;
+    std::uint32_t quantity;
+};
+
+static constexpr std::size_t DecodeBatch = 64;
+
+static spsc_ringbuffer<DecodedRecord, 1 << 12> decodedRecords;
+
+static void spsc_push_batch(benchmark::State& state)
+{
+    std::uint64_t id = 0;
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < DecodeBatch; ++i, ++id)
+        {
+            DecodedRecord record{id, id, static_cast<std::uint32_t>(id), 1};
+
+            decodedRecords.push(record);
+        }
+
+        decodedRecords.consume([](DecodedRecord& record) { benchmark::DoNotOptimize(record.id); });
+    }
+
+    state.SetItemsProcessed(state.iterations() * DecodeBatch);
+}
+
+static void spsc_reserve_commit_batch(benchmark::State& state)
+{
+    std::uint64_t id = 0;
+
+    for (auto _ : state)
+    {
+        auto slots = decodedRecords.reserve(DecodeBatch);
+
+        // Records are decoded directly into slots
+        slots.for_each([&id](DecodedRecord& record)
+        {
+            record.timestamp = id;
+            record.id = id;
+            record.price = static_cast<std::uint32_t>(id);
+            record.quantity = 1;
+            ++id;
+        });
+
+        decodedRecords.commit(slots.size());
+
+        decodedRecords.consume([](DecodedRecord& record) { benchmark::DoNotOptimize(record.id); });
+    }
+
+    state.SetItemsProcessed(state.iterations() * DecodeBatch);
+}
+
+BENCHMARK(spsc_push_batch);
+
+BENCHMARK(spsc_reserve_commit_batch);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <segmented_ringbuffer.hpp>
+#include "TestType.hpp"
+
+#include <deque>
+#include <random>
+#include <vector>
+
+// Burst lengths are precomputed, so both queues see same load
+static std::vector<std::size_t> make_bursts()
+{
+    std::mt19937 random(42);
+    std::vector<std::size_t> result(1024);
+
+    for (auto&& burst : result)
+    {
+        burst = 1 + random() % 4096;
+    }
+
+    return result;
+}
+
+template<typename Queue>
+static void bursty_load(benchmark::State& state, Queue& queue)
+{
+    static const auto bursts = make_bursts();
+
+    std::size_t items = 0;
+    std::size_t index = 0;
+
+    for (auto _ : state)
+    {
+        auto burst = bursts[index++ % bursts.size()];
+
+        for (std::size_t i = 0; i < burst; ++i)
+        {
+            queue.push_back(TEST_VALUE);
+        }
+
+        for (std::size_t i = 0; i < burst; ++i)
+        {
+            benchmark::DoNotOptimize(queue.front());
+            queue.pop_front();
+        }
+
+        items += burst;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(items));
+}
+
+static void segmented_bursty(benchmark::State& state)
+{
+    segmented_ringbuffer<Type, 1024> queue;
+
+    bursty_load(state, queue);
+}
+
+static void deque_bursty(benchmark::State& state)
+{
+    std::deque<Type> queue;
+
+    bursty_load(state, queue);
+}
+
+BENCHMARK(segmented_bursty);
+
+BENCHMARK(deque_bursty);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <sequenced_ringbuffer.hpp>
+
+#include <cstdint>
+
+static constexpr std::size_t SequencedWindowSize = 1 << 16;
+
+// Subscriber reconnects after it missed `state.range(0)`
+// elements. Without sequences it can't tell, where it
+// stopped, so whole window is sent again. With cursor
+// only missing tail is sent.
+
+static void fill_sequenced(sequenced_ringbuffer<std::uint64_t, SequencedWindowSize>& buffer)
+{
+    for (std::size_t i = 0; i < SequencedWindowSize; ++i)
+    {
+        buffer.push_back(i);
+    }
+}
+
+static void catch_up_whole_window(benchmark::State& state)
+{
+    static sequenced_ringbuffer<std::uint64_t, SequencedWindowSize> buffer;
+    fill_sequenced(buffer);
+
+    std::uint64_t sent = 0;
+
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+
+        for (auto&& el : buffer)
+        {
+            sum += el;
+        }
+
+        benchmark::DoNotOptimize(sum);
+        sent += buffer.size();
+    }
+
+    state.counters["sent_per_catch_up"] = static_cast<double>(sent) / state.iterations();
+}
+
+static void catch_up_by_cursor(benchmark::State& state)
+{
+    static sequenced_ringbuffer<std::uint64_t, SequencedWindowSize> buffer;
+    fill_sequenced(buffer);
+
+    auto missed = static_cast<std::uint64_t>(state.range(0));
+    std::uint64_t sent = 0;
+
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+
+        auto cursor = buffer.resume(buffer.next_seq() - missed);
+        auto result = buffer.read(cursor, [&sum](std::uint64_t, std::uint64_t el) { sum += el; });
+
+        benchmark::DoNotOptimize(sum);
+        sent += result.read;
+    }
+
+    state.counters["sent_per_catch_up"] = static_cast<double>(sent) / state.iterations();
+}
+
+BENCHMARK(catch_up_whole_window);
+
+BENCHMARK(catch_up_by_cursor)->RangeMultiplier(16)->Range(16, SequencedWindowSize);
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include <sharded_ringbuffer.hpp>
+#include "TestType.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+static sharded_ringbuffer<Type, 1 << 14> shardedCollector;
+static std::atomic<bool> shardedCollecting(false);
+static std::thread shardedCollectorThread;
+
+static void sharded_push_back(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        shardedCollecting = true;
+        shardedCollectorThread = std::thread([]()
+        {
+            while (shardedCollecting)
+            {
+                if (shardedCollector.drain([](Type& el) { benchmark::DoNotOptimize(el); }) == 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    auto dropped = shardedCollector.dropped();
+
+    for (auto _ : state)
+    {
+        shardedCollector.push_back(TEST_VALUE);
+    }
+
+    if (state.thread_index() == 0)
+    {
+        shardedCollecting = false;
+        shardedCollectorThread.join();
+
+        state.counters["dropped"] = static_cast<double>(shardedCollector.dropped() - dropped);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static ringbuffer<Type, 1 << 14> mutexBuffer;
+static std::mutex mutexBufferLock;
+
+static void mutex_push_back(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::lock_guard<std::mutex> lock(mutexBufferLock);
+
+        mutexBuffer.push_back(TEST_VALUE);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(sharded_push_back)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+BENCHMARK(mutex_push_back)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include <ringbuffer_streambuf.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
+static ringbuffer<char, 1 << 16> logBuffer;
+
+template<typename Stream>
+static void format_log_line(Stream& stream, std::uint64_t sequence)
+{
+    stream << "2024-01-01T00:00:00.000000Z INFO [worker-" << (sequence & 7)
+           << "] request id=" << sequence
+           << " latency=" << std::fixed << std::setprecision(3) << sequence * 0.001
+           << "ms status=" << 200 << '\n';
+}
+
+static void streambuf_log_line(benchmark::State& state)
+{
+    logBuffer.clear();
+
+    ringbuf_streambuf<1 << 16> streambuf(logBuffer);
+    std::ostream stream(&streambuf);
+
+    std::uint64_t sequence = 0;
+
+    for (auto _ : state)
+    {
+        format_log_line(stream, ++sequence);
+
+        // Consumer side: drop formatted bytes
+        if (streambuf.buffer().size() > (1 << 15))
+        {
+            streambuf.buffer().clear();
+        }
+    }
+
+    if (!stream.good())
+    {
+        state.SkipWithError("Ringbuffer overflow.");
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void stringstream_log_line(benchmark::State& state)
+{
+    logBuffer.clear();
+
+    std::uint64_t sequence = 0;
+
+    for (auto _ : state)
+    {
+        std::stringstream stream;
+
+        format_log_line(stream, ++sequence);
+
+        auto line = stream.str();
+
+        if (logBuffer.max_size() - logBuffer.size() < line.size())
+        {
+            logBuffer.clear();
+        }
+
+        for (auto ch : line)
+        {
+            logBuffer.push_back(ch);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(streambuf_log_line);
+
+BENCHMARK(stringstream_log_line);
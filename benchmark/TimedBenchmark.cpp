@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include <timed_ringbuffer.hpp>
+#include "TestType.hpp"
+
+static void plain_push_pop(benchmark::State& state)
+{
+    ringbuffer<Type, 1024> buffer;
+
+    for (auto _ : state)
+    {
+        buffer.push_back(TEST_VALUE);
+        benchmark::DoNotOptimize(buffer.front());
+        buffer.pop_front();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Clock>
+static void timed_push_pop(benchmark::State& state)
+{
+    timed_ringbuffer<Type, 1024, Clock> buffer;
+
+    for (auto _ : state)
+    {
+        buffer.push_back(TEST_VALUE);
+        benchmark::DoNotOptimize(buffer.front());
+        buffer.pop_front();
+    }
+
+    state.counters["p99"] = static_cast<double>(buffer.histogram().percentile(0.99));
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void histogram_record(benchmark::State& state)
+{
+    static dwell_time_histogram histogram;
+
+    std::uint64_t value = 1;
+
+    for (auto _ : state)
+    {
+        histogram.record(value);
+        value = value * 33 % 1000003;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(plain_push_pop);
+
+BENCHMARK_TEMPLATE(timed_push_pop, ringbuffer_steady_clock);
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+BENCHMARK_TEMPLATE(timed_push_pop, ringbuffer_tsc_clock);
+#endif
+
+BENCHMARK(histogram_record)
+    ->ThreadRange(1, 8);
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer_trace.hpp>
+#include <segmented_ringbuffer.hpp>
+#include <timed_ringbuffer.hpp>
+#include "TestType.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <random>
+
+// Trace is loaded from file, named by RINGBUFFER_TRACE
+// environment variable. Without it bursty workload is
+// recorded with synthetic pacing
+static std::vector<ringbuffer_trace::event> load_trace()
+{
+    if (auto* path = std::getenv("RINGBUFFER_TRACE"))
+    {
+        std::ifstream stream(path, std::ios::binary);
+
+        return ringbuffer_trace::load(stream).events();
+    }
+
+    std::mt19937 random(42);
+    ringbuffer_trace trace;
+    std::uint64_t timestamp = 0;
+
+    for (int i = 0; i < 1024; ++i)
+    {
+        std::uint64_t burst = 1 + random() % 512;
+
+        timestamp += 200 + random() % 800;
+        trace.record(ringbuffer_trace_op::push, burst, timestamp);
+
+        if (i % 16 == 0)
+        {
+            trace.record(ringbuffer_trace_op::iterate, burst, timestamp);
+        }
+
+        timestamp += 200 + random() % 800;
+        trace.record(ringbuffer_trace_op::pop, burst, timestamp);
+    }
+
+    return trace.events();
+}
+
+static const std::vector<ringbuffer_trace::event>& trace_events()
+{
+    static const auto events = load_trace();
+
+    return events;
+}
+
+template<typename Ring>
+static void replay(benchmark::State& state, Ring& ring, bool paced)
+{
+    auto& events = trace_events();
+
+    for (auto _ : state)
+    {
+        ringbuffer_trace_replay(events, ring, TEST_VALUE, [](const Type& el)
+        {
+            benchmark::DoNotOptimize(el);
+        }, paced);
+
+        ring.clear();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * events.size()));
+}
+
+static void trace_replay_ringbuffer(benchmark::State& state)
+{
+    static ringbuffer<Type, 1 << 12> ring;
+
+    replay(state, ring, state.range(0) != 0);
+}
+
+static void trace_replay_timed(benchmark::State& state)
+{
+    static timed_ringbuffer<Type, 1 << 12> ring;
+
+    replay(state, ring, state.range(0) != 0);
+}
+
+static void trace_replay_segmented(benchmark::State& state)
+{
+    segmented_ringbuffer<Type, 1024> ring;
+
+    replay(state, ring, state.range(0) != 0);
+}
+
+BENCHMARK(trace_replay_ringbuffer)->Arg(0);
+
+BENCHMARK(trace_replay_timed)->Arg(0);
+
+BENCHMARK(trace_replay_segmented)->Arg(0);
+
+BENCHMARK(trace_replay_ringbuffer)->Arg(1)->Iterations(4)->UseRealTime();
+
+BENCHMARK(trace_replay_segmented)->Arg(1)->Iterations(4)->UseRealTime();
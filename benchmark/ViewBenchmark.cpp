@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <ringbuffer.hpp>
+#include "TestType.hpp"
+#include "bench_extend/TemplateFunctionBenchmark.hpp"
+
+#include <memory>
+#include <vector>
+
+static std::unique_ptr<ringbuffer<Type, 1 << 16>> make_wrapped_ring()
+{
+    std::unique_ptr<ringbuffer<Type, 1 << 16>> buffer(new ringbuffer<Type, 1 << 16>());
+
+    for (Type i = 0; i < (1 << 16) + (1 << 15); ++i)
+    {
+        buffer->push_back(i);
+    }
+
+    return buffer;
+}
+
+template<std::size_t N>
+static void tail_view_sum(benchmark::State& state)
+{
+    auto buffer = make_wrapped_ring();
+
+    for (auto _ : state)
+    {
+        Type sum = 0;
+
+        buffer->tail(N).for_each([&sum](Type el) { sum += el; });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void tail_copy_sum(benchmark::State& state)
+{
+    auto buffer = make_wrapped_ring();
+
+    for (auto _ : state)
+    {
+        std::vector<Type> copy(buffer->begin() + (buffer->size() - N), buffer->end());
+
+        Type sum = 0;
+
+        for (auto el : copy)
+        {
+            sum += el;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+template<std::size_t N>
+static void stride_view_sum(benchmark::State& state)
+{
+    auto buffer = make_wrapped_ring();
+
+    for (auto _ : state)
+    {
+        Type sum = 0;
+
+        ringbuffer_stride_view<Type>(buffer->tail(N), 10).for_each([&sum](Type el) { sum += el; });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetComplexityN(static_cast<int>(N));
+}
+
+BENCHMARK_TEMPLATE_RANGE(tail_view_sum)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(tail_copy_sum)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
+
+BENCHMARK_TEMPLATE_RANGE(stride_view_sum)
+    ->TemplateRange<1 << 9, 1 << 15>()
+    ->Complexity();
@@ -0,0 +1,238 @@
+#include <benchmark/benchmark.h>
+#include <work_stealing_deque.hpp>
+#include "TestType.hpp"
+
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Minimal fork-join runner. Every worker owns
+ * a deque, executes own tasks LIFO and steals from
+ * random victims when it's out of work.
+ */
+template<typename Task>
+class fork_join_runner
+{
+public:
+    struct statistics
+    {
+        Type result;
+        std::int64_t tasks;
+        std::int64_t steals;
+        std::int64_t failedSteals;
+    };
+
+    explicit fork_join_runner(std::size_t threads) :
+        m_deques(threads)
+    {
+        for (auto&& deque : m_deques)
+        {
+            deque.reset(new work_stealing_deque<Task>(256));
+        }
+    }
+
+    /**
+     * @brief Execute function receives task, callback for
+     * spawning subtasks and returns leaf result.
+     */
+    template<typename Execute>
+    statistics run(const Task& root, Execute execute)
+    {
+        std::atomic<std::int64_t> pending(1);
+        std::atomic<Type> result(0);
+        std::atomic<std::int64_t> tasks(0);
+        std::atomic<std::int64_t> steals(0);
+        std::atomic<std::int64_t> failedSteals(0);
+
+        m_deques[0]->push(root);
+
+        auto worker = [&](std::size_t index)
+        {
+            auto& own = *m_deques[index];
+
+            Type localResult = 0;
+            std::int64_t localTasks = 0;
+            std::int64_t localSteals = 0;
+            std::int64_t localFailed = 0;
+
+            auto spawn = [&](const Task& task)
+            {
+                pending.fetch_add(1, std::memory_order_relaxed);
+                own.push(task);
+            };
+
+            std::size_t victim = index;
+            Task task;
+
+            while (pending.load(std::memory_order_acquire) != 0)
+            {
+                if (!own.pop(task))
+                {
+                    victim = (victim * 1103515245 + 12345) % m_deques.size();
+
+                    if (victim == index || !m_deques[victim]->steal(task))
+                    {
+                        ++localFailed;
+                        continue;
+                    }
+
+                    ++localSteals;
+                }
+
+                localResult += execute(task, spawn);
+                ++localTasks;
+
+                pending.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            result += localResult;
+            tasks += localTasks;
+            steals += localSteals;
+            failedSteals += localFailed;
+        };
+
+        std::vector<std::thread> threads;
+
+        for (std::size_t i = 1; i < m_deques.size(); ++i)
+        {
+            threads.emplace_back(worker, i);
+        }
+
+        worker(0);
+
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+
+        return {result.load(), tasks.load(), steals.load(), failedSteals.load()};
+    }
+
+private:
+    std::vector<std::unique_ptr<work_stealing_deque<Task>>> m_deques;
+};
+
+static Type serial_fib(int n)
+{
+    return n < 2 ? static_cast<Type>(n) : serial_fib(n - 1) + serial_fib(n - 2);
+}
+
+static void report(benchmark::State& state, std::int64_t tasks, std::int64_t steals, std::int64_t failed)
+{
+    auto iterations = static_cast<double>(state.iterations());
+
+    state.counters["tasks"] = tasks / iterations;
+    state.counters["steals"] = steals / iterations;
+    state.counters["steal_rate"] = tasks == 0 ? 0.0 : static_cast<double>(steals) / tasks;
+    state.counters["failed_steals"] = failed / iterations;
+}
+
+static void fork_join_fib(benchmark::State& state)
+{
+    constexpr int N = 30;
+    constexpr int Cutoff = 12;
+
+    fork_join_runner<int> runner(static_cast<std::size_t>(state.range(0)));
+
+    std::int64_t tasks = 0;
+    std::int64_t steals = 0;
+    std::int64_t failed = 0;
+
+    for (auto _ : state)
+    {
+        auto statistics = runner.run(N, [](int n, auto& spawn)
+        {
+            // Spawning one branch, continuing with other one
+            while (n >= Cutoff)
+            {
+                spawn(n - 2);
+                --n;
+            }
+
+            return serial_fib(n);
+        });
+
+        if (statistics.result != serial_fib(N))
+        {
+            state.SkipWithError("Wrong result");
+        }
+
+        tasks += statistics.tasks;
+        steals += statistics.steals;
+        failed += statistics.failedSteals;
+    }
+
+    report(state, tasks, steals, failed);
+}
+
+struct range_task
+{
+    std::uint32_t begin;
+    std::uint32_t end;
+};
+
+static void fork_join_tree_sum(benchmark::State& state)
+{
+    constexpr std::uint32_t Count = 1u << 22;
+    constexpr std::uint32_t Grain = 4096;
+
+    std::vector<Type> values(Count);
+    std::iota(values.begin(), values.end(), Type(0));
+
+    auto expected = std::accumulate(values.begin(), values.end(), Type(0));
+
+    fork_join_runner<range_task> runner(static_cast<std::size_t>(state.range(0)));
+
+    std::int64_t tasks = 0;
+    std::int64_t steals = 0;
+    std::int64_t failed = 0;
+
+    for (auto _ : state)
+    {
+        auto statistics = runner.run(
+            range_task{0, Count},
+            [&values](range_task task, auto& spawn)
+            {
+                while (task.end - task.begin > Grain)
+                {
+                    auto middle = task.begin + (task.end - task.begin) / 2;
+
+                    spawn(range_task{middle, task.end});
+                    task.end = middle;
+                }
+
+                Type sum = 0;
+
+                for (auto i = task.begin; i < task.end; ++i)
+                {
+                    sum += values[i];
+                }
+
+                return sum;
+            }
+        );
+
+        if (statistics.result != expected)
+        {
+            state.SkipWithError("Wrong result");
+        }
+
+        tasks += statistics.tasks;
+        steals += statistics.steals;
+        failed += statistics.failedSteals;
+    }
+
+    report(state, tasks, steals, failed);
+}
+
+BENCHMARK(fork_join_fib)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+
+BENCHMARK(fork_join_tree_sum)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Collector of performance counters of calling
+ * thread, based on `perf_event_open`. Counters, that can't
+ * be opened (not permitted by `perf_event_paranoid`, not
+ * exposed by virtual machine, not Linux), are skipped, so
+ * benchmarks still run and report time only.
+ */
+class PerfCounterCollector
+{
+    struct Counter
+    {
+        const char* name;
+        int fd;
+        double value;
+    };
+
+public:
+    PerfCounterCollector() :
+            _counters()
+    {
+#if defined(__linux__)
+        open("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        open("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        open("cache_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        open("branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        open("dtlb_misses",
+             PERF_TYPE_HW_CACHE,
+             PERF_COUNT_HW_CACHE_DTLB |
+             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+        open("page_faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+#endif
+
+        if (_counters.empty())
+        {
+            static bool warned = false;
+
+            if (!warned)
+            {
+                std::cerr << "Performance counters are not available, "
+                             "benchmarks report time only." << std::endl;
+                warned = true;
+            }
+        }
+    }
+
+    PerfCounterCollector(const PerfCounterCollector&) = delete;
+
+    PerfCounterCollector& operator=(const PerfCounterCollector&) = delete;
+
+    ~PerfCounterCollector()
+    {
+#if defined(__linux__)
+        for (auto&& counter : _counters)
+        {
+            ::close(counter.fd);
+        }
+#endif
+    }
+
+    bool Available() const
+    {
+        return !_counters.empty();
+    }
+
+    void Start()
+    {
+#if defined(__linux__)
+        for (auto&& counter : _counters)
+        {
+            ::ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void Stop()
+    {
+#if defined(__linux__)
+        for (auto&& counter : _counters)
+        {
+            ::ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+
+        for (auto&& counter : _counters)
+        {
+            // Value, time enabled, time running
+            std::uint64_t data[3] = {0, 0, 0};
+
+            counter.value = 0;
+
+            if (::read(counter.fd, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0)
+            {
+                continue;
+            }
+
+            // Scaling, if counters were multiplexed
+            counter.value = static_cast<double>(data[0]) * data[1] / data[2];
+        }
+#endif
+    }
+
+    /**
+     * @brief Method for adding collected counters to benchmark
+     * user counters, averaged per iteration.
+     */
+    void Report(benchmark::State& state) const
+    {
+        double cycles = 0;
+        double instructions = 0;
+
+        for (auto&& counter : _counters)
+        {
+            state.counters[counter.name] = benchmark::Counter(counter.value, benchmark::Counter::kAvgIterations);
+
+            if (std::strcmp(counter.name, "cycles") == 0)
+            {
+                cycles = counter.value;
+            }
+            else if (std::strcmp(counter.name, "instructions") == 0)
+            {
+                instructions = counter.value;
+            }
+        }
+
+        if (cycles != 0 && instructions != 0)
+        {
+            state.counters["IPC"] = instructions / cycles;
+        }
+    }
+
+private:
+
+#if defined(__linux__)
+    void open(const char* name, std::uint32_t type, std::uint64_t config)
+    {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+
+        attributes.size = sizeof(attributes);
+        attributes.type = type;
+        attributes.config = config;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        auto fd = ::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+
+        if (fd >= 0)
+        {
+            _counters.push_back(Counter{name, static_cast<int>(fd), 0});
+        }
+    }
+#endif
+
+    std::vector<Counter> _counters;
+};
@@ -3,6 +3,8 @@
 #include <benchmark/benchmark.h>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include "PerfCounters.hpp"
 
 #define BENCHMARK_TEMPLATE_RANGE(x)               \
 template<int N>                                        \
@@ -25,7 +27,8 @@ class TemplateFunctionBenchmark : public ::benchmark::internal::Benchmark
 public:
     explicit TemplateFunctionBenchmark(const char* name) :
             Benchmark(name),
-            _name(name)
+            _name(name),
+            _perfCounters()
     {
 
     }
@@ -51,6 +54,21 @@ public:
         return this;
     };
 
+    /**
+     * @brief Enables reporting of hardware performance
+     * counters per iteration (cycles, instructions, IPC,
+     * cache, branch and TLB misses). Counters cover whole
+     * benchmark function, so setup before the loop is
+     * included, amortized by iterations. If counters are
+     * not permitted, benchmark reports time only.
+     */
+    TemplateFunctionBenchmark* PerfCounters()
+    {
+        _perfCounters.reset(new PerfCounterCollector());
+
+        return this;
+    }
+
     void Run(benchmark::State& state) override
     {
         if (_tests.empty())
@@ -68,6 +86,15 @@ public:
             return;
         }
 
+        if (_perfCounters && _perfCounters->Available())
+        {
+            _perfCounters->Start();
+            searchResult->second(state);
+            _perfCounters->Stop();
+            _perfCounters->Report(state);
+            return;
+        }
+
         searchResult->second(state);
     }
 
@@ -131,4 +158,5 @@ private:
 
     FuncMap _tests;
     const char* _name;
+    std::unique_ptr<PerfCounterCollector> _perfCounters;
 };
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Policy for records, logged into full queue.
+ */
+enum class ringbuffer_overflow_policy
+{
+    drop,      ///< New record is dropped.
+    block,     ///< Producer waits for free slot.
+    overwrite  ///< Oldest queued record is overwritten.
+};
+
+/**
+ * @brief Options of asynchronous logger.
+ */
+struct ringbuffer_logger_options
+{
+    ringbuffer_logger_options() :
+        flush_size(1 << 16),
+        flush_interval(100),
+        batch_size(256),
+        overflow(ringbuffer_overflow_policy::drop)
+    {
+
+    }
+
+    /**
+     * @brief Number of formatted bytes, that triggers
+     * write to sink.
+     */
+    std::size_t flush_size;
+
+    /**
+     * @brief Maximum time formatted bytes wait
+     * for write to sink.
+     */
+    std::chrono::milliseconds flush_interval;
+
+    /**
+     * @brief Maximum number of records taken from
+     * queue under one lock.
+     */
+    std::size_t batch_size;
+
+    /**
+     * @brief What to do, when queue is full.
+     */
+    ringbuffer_overflow_policy overflow;
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * @brief Sink, that writes bytes to file descriptor.
+ * Partial writes are continued, on error rest
+ * of data is discarded.
+ */
+struct ringbuffer_fd_sink
+{
+    explicit ringbuffer_fd_sink(int fd) :
+        fd(fd)
+    {
+
+    }
+
+    void operator()(const char* data, std::size_t size) const
+    {
+        while (size != 0)
+        {
+            auto result = ::write(fd, data, size);
+
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return;
+            }
+
+            data += result;
+            size -= static_cast<std::size_t>(result);
+        }
+    }
+
+    int fd;
+};
+#endif
+
+/**
+ * @brief Class, that describes asynchronous logger.
+ * Producers enqueue fixed size records into ringbuffer,
+ * background thread takes them in batches, formats them
+ * into staging buffer and passes it to sink with large
+ * sequential writes (when `flush_size` bytes are collected,
+ * when `flush_interval` elapsed, on `flush` and on shutdown).
+ * @tparam Record Record type.
+ * @tparam Size Queue size.
+ * @tparam Formatter Callable with `void(const Record&, std::string&)`
+ * signature, that appends formatted record.
+ * @tparam Sink Callable with `void(const char*, std::size_t)` signature.
+ */
+template<typename Record, std::size_t Size, typename Formatter, typename Sink>
+class async_ringbuffer_logger
+{
+public:
+
+    using record_type = Record;
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructor. Starts background thread.
+     * @param formatter Formatter.
+     * @param sink Sink.
+     * @param options Options.
+     */
+    async_ringbuffer_logger(Formatter formatter,
+                            Sink sink,
+                            const ringbuffer_logger_options& options = ringbuffer_logger_options()) :
+        m_formatter(std::move(formatter)),
+        m_sink(std::move(sink)),
+        m_options(options),
+        m_queue(),
+        m_mutex(),
+        m_notEmpty(),
+        m_notFull(),
+        m_flushed(),
+        m_stopping(false),
+        m_flushRequested(false),
+        m_accepted(0),
+        m_retired(0),
+        m_durable(0),
+        m_dropped(0),
+        m_overwritten(0),
+        m_thread()
+    {
+        m_thread = std::thread(&async_ringbuffer_logger::run, this);
+    }
+
+    async_ringbuffer_logger(const async_ringbuffer_logger&) = delete;
+
+    async_ringbuffer_logger& operator=(const async_ringbuffer_logger&) = delete;
+
+    /**
+     * @brief Destructor. Writes all queued records.
+     */
+    ~async_ringbuffer_logger()
+    {
+        shutdown();
+    }
+
+    /**
+     * @brief Method for logging record.
+     * @param record Record.
+     * @return False if record was dropped (because queue is
+     * full with `drop` policy or logger is shut down).
+     */
+    bool log(const record_type& record)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_queue.size() == Size && !m_stopping)
+        {
+            switch (m_options.overflow)
+            {
+            case ringbuffer_overflow_policy::drop:
+                ++m_dropped;
+                return false;
+
+            case ringbuffer_overflow_policy::block:
+                m_notFull.wait(lock, [this]() { return m_queue.size() != Size || m_stopping; });
+                break;
+
+            case ringbuffer_overflow_policy::overwrite:
+                ++m_overwritten;
+                ++m_retired;
+                break;
+            }
+        }
+
+        if (m_stopping)
+        {
+            ++m_dropped;
+            return false;
+        }
+
+        auto wasEmpty = m_queue.empty();
+
+        m_queue.push_back(record);
+        ++m_accepted;
+
+        lock.unlock();
+
+        if (wasEmpty)
+        {
+            m_notEmpty.notify_one();
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Method for waiting until all records, logged
+     * before this call, are passed to sink.
+     */
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto target = m_accepted;
+
+        if (m_durable >= target || !m_thread.joinable())
+        {
+            return;
+        }
+
+        m_flushRequested = true;
+        m_notEmpty.notify_one();
+
+        m_flushed.wait(lock, [this, target]() { return m_durable >= target; });
+    }
+
+    /**
+     * @brief Method for stopping logger. All queued
+     * records are written, later records are dropped.
+     */
+    void shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_stopping = true;
+        }
+
+        m_notEmpty.notify_one();
+        m_notFull.notify_all();
+
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    /**
+     * @brief Method for getting number of dropped records.
+     */
+    std::uint64_t dropped() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return m_dropped;
+    }
+
+    /**
+     * @brief Method for getting number of records,
+     * overwritten before being written.
+     */
+    std::uint64_t overwritten() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return m_overwritten;
+    }
+
+private:
+
+    void run()
+    {
+        std::vector<record_type> batch;
+        batch.reserve(m_options.batch_size);
+
+        std::string staging;
+        staging.reserve(m_options.flush_size + 1024);
+
+        auto lastWrite = std::chrono::steady_clock::now();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true)
+        {
+            m_notEmpty.wait_for(lock, m_options.flush_interval, [this]()
+            {
+                return !m_queue.empty() || m_stopping || m_flushRequested;
+            });
+
+            auto count = std::min(m_queue.size(), m_options.batch_size);
+
+            for (size_type i = 0; i < count; ++i)
+            {
+                batch.push_back(m_queue[i]);
+            }
+
+            m_queue.pop_front(count);
+            m_retired += count;
+
+            auto retired = m_retired;
+            auto drained = m_queue.empty();
+            auto stop = m_stopping && drained;
+            auto flushRequested = m_flushRequested && drained;
+
+            if (flushRequested)
+            {
+                m_flushRequested = false;
+            }
+
+            lock.unlock();
+
+            if (count != 0)
+            {
+                m_notFull.notify_all();
+            }
+
+            for (auto&& record : batch)
+            {
+                m_formatter(record, staging);
+
+                if (staging.size() >= m_options.flush_size)
+                {
+                    m_sink(staging.data(), staging.size());
+                    staging.clear();
+                    lastWrite = std::chrono::steady_clock::now();
+                }
+            }
+
+            batch.clear();
+
+            auto now = std::chrono::steady_clock::now();
+
+            if (stop || flushRequested || now - lastWrite >= m_options.flush_interval)
+            {
+                if (!staging.empty())
+                {
+                    m_sink(staging.data(), staging.size());
+                    staging.clear();
+                }
+
+                lastWrite = now;
+            }
+
+            lock.lock();
+
+            if (staging.empty() && m_durable != retired)
+            {
+                m_durable = retired;
+                m_flushed.notify_all();
+            }
+
+            if (stop)
+            {
+                break;
+            }
+        }
+    }
+
+    Formatter m_formatter;
+    Sink m_sink;
+    const ringbuffer_logger_options m_options;
+
+    ringbuffer<record_type, Size> m_queue;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
+    std::condition_variable m_flushed;
+
+    bool m_stopping;
+    bool m_flushRequested;
+
+    std::uint64_t m_accepted;
+    std::uint64_t m_retired;
+    std::uint64_t m_durable;
+    std::uint64_t m_dropped;
+    std::uint64_t m_overwritten;
+
+    std::thread m_thread;
+};
+
+/**
+ * @brief Function for creating asynchronous logger
+ * with deduced formatter and sink types.
+ * @tparam Record Record type.
+ * @tparam Size Queue size.
+ * @param formatter Formatter.
+ * @param sink Sink.
+ * @param options Options.
+ * @return Owning pointer to started logger.
+ */
+template<typename Record, std::size_t Size, typename Formatter, typename Sink>
+std::unique_ptr<async_ringbuffer_logger<Record, Size, Formatter, Sink>>
+make_async_ringbuffer_logger(Formatter formatter,
+                             Sink sink,
+                             const ringbuffer_logger_options& options = ringbuffer_logger_options())
+{
+    return std::unique_ptr<async_ringbuffer_logger<Record, Size, Formatter, Sink>>(
+        new async_ringbuffer_logger<Record, Size, Formatter, Sink>(
+            std::move(formatter),
+            std::move(sink),
+            options
+        )
+    );
+}
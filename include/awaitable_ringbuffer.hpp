@@ -0,0 +1,553 @@
+#pragma once
+
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Intrusive node, that's used to post
+ * suspended coroutine to executor without allocation.
+ * Awaiters embed it, so it lives in coroutine frame.
+ */
+struct ringbuffer_task_node
+{
+    std::coroutine_handle<> handle = nullptr;
+    ringbuffer_task_node* next = nullptr;
+};
+
+/**
+ * @brief Interface of executor, that resumes
+ * coroutines suspended on `awaitable_ringbuffer`.
+ */
+class ringbuffer_executor
+{
+public:
+
+    /**
+     * @brief Awaiter, that moves current coroutine to
+     * this executor.
+     */
+    class schedule_awaiter
+    {
+    public:
+        explicit schedule_awaiter(ringbuffer_executor& executor) :
+            m_executor(executor),
+            m_node()
+        {
+
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_node.handle = handle;
+            m_executor.post(&m_node);
+        }
+
+        void await_resume() const noexcept
+        {
+
+        }
+
+    private:
+        ringbuffer_executor& m_executor;
+        ringbuffer_task_node m_node;
+    };
+
+    virtual ~ringbuffer_executor() = default;
+
+    /**
+     * @brief Method for scheduling coroutine resumption.
+     * Node must stay alive until coroutine is resumed.
+     * @param node Node with coroutine handle.
+     */
+    virtual void post(ringbuffer_task_node* node) = 0;
+
+    /**
+     * @brief Method for switching current coroutine
+     * to this executor. `co_await executor.schedule()`.
+     */
+    schedule_awaiter schedule()
+    {
+        return schedule_awaiter(*this);
+    }
+};
+
+/**
+ * @brief Intrusive FIFO of task nodes.
+ */
+class ringbuffer_task_queue
+{
+public:
+    void push(ringbuffer_task_node* node)
+    {
+        node->next = nullptr;
+
+        if (m_tail == nullptr)
+        {
+            m_head = node;
+        }
+        else
+        {
+            m_tail->next = node;
+        }
+
+        m_tail = node;
+    }
+
+    ringbuffer_task_node* pop()
+    {
+        auto* node = m_head;
+
+        if (node != nullptr)
+        {
+            m_head = node->next;
+
+            if (m_head == nullptr)
+            {
+                m_tail = nullptr;
+            }
+        }
+
+        return node;
+    }
+
+    bool empty() const
+    {
+        return m_head == nullptr;
+    }
+
+private:
+    ringbuffer_task_node* m_head = nullptr;
+    ringbuffer_task_node* m_tail = nullptr;
+};
+
+/**
+ * @brief Executor, that resumes coroutines on
+ * thread, that calls `run`.
+ */
+class ringbuffer_single_thread_executor : public ringbuffer_executor
+{
+public:
+    void post(ringbuffer_task_node* node) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_queue.push(node);
+    }
+
+    /**
+     * @brief Method for resuming scheduled coroutines
+     * until there is nothing left.
+     * @return Number of resumed coroutines.
+     */
+    std::size_t run()
+    {
+        std::size_t count = 0;
+
+        while (auto* node = next())
+        {
+            node->handle.resume();
+            ++count;
+        }
+
+        return count;
+    }
+
+private:
+    ringbuffer_task_node* next()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return m_queue.pop();
+    }
+
+    std::mutex m_mutex;
+    ringbuffer_task_queue m_queue;
+};
+
+/**
+ * @brief Executor, that resumes coroutines on
+ * fixed number of worker threads.
+ */
+class ringbuffer_thread_pool : public ringbuffer_executor
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param threads Number of worker threads.
+     */
+    explicit ringbuffer_thread_pool(std::size_t threads) :
+        m_mutex(),
+        m_condition(),
+        m_queue(),
+        m_stopped(false),
+        m_threads()
+    {
+        for (std::size_t i = 0; i < threads; ++i)
+        {
+            m_threads.emplace_back([this]() { work(); });
+        }
+    }
+
+    ~ringbuffer_thread_pool() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopped = true;
+        }
+
+        m_condition.notify_all();
+
+        for (auto&& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    void post(ringbuffer_task_node* node) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push(node);
+        }
+
+        m_condition.notify_one();
+    }
+
+private:
+    void work()
+    {
+        while (true)
+        {
+            ringbuffer_task_node* node = nullptr;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                m_condition.wait(lock, [this]() { return m_stopped || !m_queue.empty(); });
+
+                if (m_queue.empty())
+                {
+                    return;
+                }
+
+                node = m_queue.pop();
+            }
+
+            node->handle.resume();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    ringbuffer_task_queue m_queue;
+    bool m_stopped;
+    std::vector<std::thread> m_threads;
+};
+
+/**
+ * @brief Fire and forget coroutine type. Coroutine
+ * starts eagerly and destroys itself on completion.
+ */
+struct ringbuffer_detached_task
+{
+    struct promise_type
+    {
+        ringbuffer_detached_task get_return_object() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+/**
+ * @brief Bounded queue on top of ringbuffer, that
+ * suspends coroutine instead of blocking thread.
+ * `co_await queue.pop(executor)` suspends while queue
+ * is empty, `co_await queue.push(value, executor)`
+ * suspends while queue is full. Suspended coroutine is
+ * resumed on executor, it has passed. Waiters are
+ * intrusive nodes inside awaiters, so operations
+ * don't allocate.
+ * @tparam T Value type.
+ * @tparam Size Queue capacity.
+ */
+template<typename T, std::size_t Size>
+class awaitable_ringbuffer
+{
+    struct waiter : ringbuffer_task_node
+    {
+        ringbuffer_executor* executor = nullptr;
+        waiter* next_waiter = nullptr;
+    };
+
+    struct waiter_list
+    {
+        void push(waiter* node)
+        {
+            node->next_waiter = nullptr;
+
+            if (tail == nullptr)
+            {
+                head = node;
+            }
+            else
+            {
+                tail->next_waiter = node;
+            }
+
+            tail = node;
+        }
+
+        waiter* pop()
+        {
+            auto* node = head;
+
+            if (node != nullptr)
+            {
+                head = node->next_waiter;
+
+                if (head == nullptr)
+                {
+                    tail = nullptr;
+                }
+            }
+
+            return node;
+        }
+
+        waiter* head = nullptr;
+        waiter* tail = nullptr;
+    };
+
+public:
+
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Awaiter for popping value.
+     */
+    class pop_awaiter : public waiter
+    {
+        friend class awaitable_ringbuffer;
+
+    public:
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> coroutine)
+        {
+            waiter* producer = nullptr;
+
+            {
+                std::lock_guard<std::mutex> lock(m_owner.m_mutex);
+
+                if (m_owner.m_buffer.empty())
+                {
+                    this->handle = coroutine;
+                    m_owner.m_consumers.push(this);
+                    return true;
+                }
+
+                m_value = std::move(m_owner.m_buffer.front());
+                m_owner.m_buffer.pop_front();
+
+                producer = m_owner.m_producers.pop();
+
+                if (producer != nullptr)
+                {
+                    auto* pusher = static_cast<push_awaiter*>(producer);
+                    m_owner.m_buffer.push_back(std::move(pusher->m_value));
+                }
+            }
+
+            if (producer != nullptr)
+            {
+                producer->executor->post(producer);
+            }
+
+            return false;
+        }
+
+        value_type await_resume()
+        {
+            return std::move(m_value);
+        }
+
+    private:
+        pop_awaiter(awaitable_ringbuffer& owner, ringbuffer_executor& executor) :
+            m_owner(owner),
+            m_value()
+        {
+            this->executor = &executor;
+        }
+
+        awaitable_ringbuffer& m_owner;
+        value_type m_value;
+    };
+
+    /**
+     * @brief Awaiter for pushing value.
+     */
+    class push_awaiter : public waiter
+    {
+        friend class awaitable_ringbuffer;
+
+    public:
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> coroutine)
+        {
+            waiter* consumer = nullptr;
+
+            {
+                std::lock_guard<std::mutex> lock(m_owner.m_mutex);
+
+                consumer = m_owner.m_consumers.pop();
+
+                if (consumer != nullptr)
+                {
+                    // Queue is empty, value goes directly to consumer
+                    static_cast<pop_awaiter*>(consumer)->m_value = std::move(m_value);
+                }
+                else if (m_owner.m_buffer.size() < Size)
+                {
+                    m_owner.m_buffer.push_back(std::move(m_value));
+                }
+                else
+                {
+                    this->handle = coroutine;
+                    m_owner.m_producers.push(this);
+                    return true;
+                }
+            }
+
+            if (consumer != nullptr)
+            {
+                consumer->executor->post(consumer);
+            }
+
+            return false;
+        }
+
+        void await_resume() const noexcept
+        {
+
+        }
+
+    private:
+        push_awaiter(awaitable_ringbuffer& owner,
+                     value_type value,
+                     ringbuffer_executor& executor) :
+            m_owner(owner),
+            m_value(std::move(value))
+        {
+            this->executor = &executor;
+        }
+
+        awaitable_ringbuffer& m_owner;
+        value_type m_value;
+    };
+
+    awaitable_ringbuffer() :
+        m_mutex(),
+        m_buffer(),
+        m_consumers(),
+        m_producers()
+    {
+
+    }
+
+    awaitable_ringbuffer(const awaitable_ringbuffer&) = delete;
+
+    awaitable_ringbuffer& operator=(const awaitable_ringbuffer&) = delete;
+
+    /**
+     * @brief Method for popping value from front.
+     * @param executor Executor to resume coroutine on,
+     * if it has to wait for value.
+     * @return Awaiter, that results in popped value.
+     */
+    pop_awaiter pop(ringbuffer_executor& executor)
+    {
+        return pop_awaiter(*this, executor);
+    }
+
+    /**
+     * @brief Method for pushing value to back.
+     * @param value Value.
+     * @param executor Executor to resume coroutine on,
+     * if it has to wait for free space.
+     * @return Awaiter.
+     */
+    push_awaiter push(value_type value, ringbuffer_executor& executor)
+    {
+        return push_awaiter(*this, std::move(value), executor);
+    }
+
+    /**
+     * @brief Method for getting number of queued values.
+     */
+    size_type size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return m_buffer.size();
+    }
+
+    /**
+     * @brief Return maximum size.
+     */
+    size_type max_size() const
+    {
+        return Size;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    ringbuffer<T, Size> m_buffer;
+    waiter_list m_consumers;
+    waiter_list m_producers;
+};
+
+#endif
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "ringbuffer.hpp"
+#include "ringbuffer_thread_registry.hpp"
+
+/**
+ * @brief Class, that describes multi producer, single
+ * consumer front end for ringbuffer, based on flat
+ * combining. Producer publishes value in own slot
+ * (separate cache line) and tries to take combiner lock.
+ * Combiner applies all published values to ringbuffer
+ * in one pass, other producers just wait until their
+ * slots are served. So ringbuffer is modified by one
+ * thread at a time without CAS loops on its indices, and
+ * its cache lines stay on combiner core.
+ * Like `ringbuffer` it overwrites oldest values, when full.
+ * @tparam T Value type.
+ * @tparam Size Ringbuffer size.
+ */
+template<typename T, std::size_t Size>
+class combining_ringbuffer
+{
+    struct slot
+    {
+        slot() :
+            pending(false),
+            claimed(true),
+            value()
+        {
+
+        }
+
+        alignas(64) std::atomic<bool> pending;
+        std::atomic<bool> claimed;
+        T value;
+    };
+
+public:
+
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    combining_ringbuffer() :
+        m_locked(false),
+        m_overwritten(0),
+        m_combines(0),
+        m_buffer(),
+        m_slots()
+    {
+
+    }
+
+    combining_ringbuffer(const combining_ringbuffer&) = delete;
+
+    combining_ringbuffer& operator=(const combining_ringbuffer&) = delete;
+
+    /**
+     * @brief Method for pushing value. Returns, when
+     * value is in ringbuffer.
+     * @param value Value.
+     */
+    void push_back(const value_type& value)
+    {
+        auto& current = m_slots.local();
+
+        current.value = value;
+        current.pending.store(true, std::memory_order_release);
+
+        while (true)
+        {
+            if (try_lock())
+            {
+                // Own slot is published before lock,
+                // so it's served by this pass
+                combine();
+                unlock();
+                return;
+            }
+
+            for (int i = 0; i < SpinCount; ++i)
+            {
+                if (!current.pending.load(std::memory_order_acquire))
+                {
+                    return;
+                }
+            }
+
+            std::this_thread::yield();
+
+            if (!current.pending.load(std::memory_order_acquire))
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Method for taking values from front.
+     * Producers wait while function is called,
+     * so it should be short.
+     * May be called only by single consumer thread.
+     * @tparam Function Callable with `void(value_type&)` signature.
+     * @param function Function.
+     * @param batch Maximum number of values.
+     * @return Number of taken values.
+     */
+    template<typename Function>
+    size_type drain(Function function, size_type batch = Size)
+    {
+        lock();
+        combine();
+
+        auto count = std::min(batch, m_buffer.size());
+
+        m_buffer.view().subspan(0, count).for_each(function);
+        m_buffer.pop_front(count);
+
+        unlock();
+
+        return count;
+    }
+
+    /**
+     * @brief Method for taking value from front.
+     * May be called only by single consumer thread.
+     * @param value Taken value.
+     * @return False if there is no values.
+     */
+    bool try_pop(value_type& value)
+    {
+        return drain([&value](value_type& el) { value = std::move(el); }, 1) != 0;
+    }
+
+    size_type size()
+    {
+        lock();
+        combine();
+
+        auto result = m_buffer.size();
+
+        unlock();
+
+        return result;
+    }
+
+    /**
+     * @brief Method for getting number of values,
+     * overwritten before being taken.
+     */
+    std::uint64_t overwritten() const
+    {
+        return m_overwritten.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Method for getting number of combining
+     * passes (average batch is number of pushes
+     * divided by it).
+     */
+    std::uint64_t combines() const
+    {
+        return m_combines.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    static constexpr int SpinCount = 128;
+
+    bool try_lock()
+    {
+        return !m_locked.load(std::memory_order_relaxed) &&
+               !m_locked.exchange(true, std::memory_order_acquire);
+    }
+
+    void lock()
+    {
+        while (!try_lock())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void unlock()
+    {
+        m_locked.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Method for applying published values.
+     * Must be called under combiner lock.
+     */
+    void combine()
+    {
+        std::uint64_t overwritten = 0;
+
+        m_slots.for_each([this, &overwritten](slot& current)
+        {
+            if (!current.pending.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            if (m_buffer.size() == Size)
+            {
+                ++overwritten;
+            }
+
+            m_buffer.push_back(current.value);
+            current.pending.store(false, std::memory_order_release);
+        });
+
+        // Counters are written only by combiner
+        m_combines.store(m_combines.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        if (overwritten != 0)
+        {
+            m_overwritten.store(m_overwritten.load(std::memory_order_relaxed) + overwritten, std::memory_order_relaxed);
+        }
+    }
+
+    alignas(64) std::atomic<bool> m_locked;
+    std::atomic<std::uint64_t> m_overwritten;
+    std::atomic<std::uint64_t> m_combines;
+    alignas(64) ringbuffer<T, Size> m_buffer;
+    ringbuffer_detail::thread_registry<slot> m_slots;
+};
+
+// Out of class definition is required before C++17
+template<typename T, std::size_t Size>
+constexpr int combining_ringbuffer<T, Size>::SpinCount;
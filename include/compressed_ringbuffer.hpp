@@ -0,0 +1,570 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ringbuffer_bits.hpp"
+
+namespace ringbuffer_detail
+{
+    /**
+     * @brief Codec, that turns integral values into
+     * zigzag encoded deltas from previous value.
+     */
+    template<typename T, typename = void>
+    struct residual_codec
+    {
+        static_assert(std::is_integral<T>::value,
+                      "Only integral and floating point types can be compressed.");
+
+        using unsigned_type = typename std::make_unsigned<T>::type;
+        using signed_type = typename std::make_signed<T>::type;
+
+        static std::uint64_t to_bits(T value)
+        {
+            return static_cast<std::uint64_t>(static_cast<unsigned_type>(value));
+        }
+
+        static T from_bits(std::uint64_t bits)
+        {
+            return static_cast<T>(static_cast<unsigned_type>(bits));
+        }
+
+        static std::uint64_t encode(std::uint64_t previous, std::uint64_t current)
+        {
+            auto delta = static_cast<std::int64_t>(
+                static_cast<signed_type>(static_cast<unsigned_type>(current - previous))
+            );
+
+            return (static_cast<std::uint64_t>(delta) << 1) ^
+                   static_cast<std::uint64_t>(delta >> 63);
+        }
+
+        static std::uint64_t decode(std::uint64_t previous, std::uint64_t residual)
+        {
+            auto delta = (residual >> 1) ^ (~(residual & 1) + 1);
+
+            return static_cast<unsigned_type>(previous + delta);
+        }
+    };
+
+    /**
+     * @brief Codec, that turns floating point values into
+     * XOR with previous value bit pattern (Gorilla-like).
+     */
+    template<typename T>
+    struct residual_codec<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+    {
+        static_assert(sizeof(T) <= sizeof(std::uint64_t),
+                      "Floating point type is too wide.");
+
+        static std::uint64_t to_bits(T value)
+        {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(T));
+            return bits;
+        }
+
+        static T from_bits(std::uint64_t bits)
+        {
+            T value;
+            std::memcpy(&value, &bits, sizeof(T));
+            return value;
+        }
+
+        static std::uint64_t encode(std::uint64_t previous, std::uint64_t current)
+        {
+            return previous ^ current;
+        }
+
+        static std::uint64_t decode(std::uint64_t previous, std::uint64_t residual)
+        {
+            return previous ^ residual;
+        }
+    };
+}
+
+/**
+ * @brief Class, that describes ringbuffer of numeric values,
+ * that stores history in compressed blocks.
+ * Values are collected into raw open block. When it's
+ * filled, block gets sealed: first value is stored as is,
+ * others are stored as residuals (zigzag deltas for integral
+ * types, XOR of bit patterns for floating point types),
+ * bit-packed with minimal width for this block. Leading
+ * and trailing bits, that are zero in all residuals of
+ * block, aren't stored.
+ * When there is no space for new sealed block, oldest
+ * block is evicted.
+ * @tparam T Value type. Integral or floating point.
+ * @tparam BlockCount Number of sealed blocks.
+ * @tparam BlockSize Number of values in one block.
+ */
+template<typename T, std::size_t BlockCount, std::size_t BlockSize = 128>
+class compressed_ringbuffer
+{
+    static_assert(BlockCount > 0, "Empty ringbuffer is not allowed.");
+    static_assert(BlockSize > 1, "Block must contain at least 2 values.");
+
+    using codec = ringbuffer_detail::residual_codec<T>;
+
+    struct block
+    {
+        block() :
+            base(0),
+            width(0),
+            shift(0),
+            words()
+        {
+
+        }
+
+        std::uint64_t base;
+
+        // Residuals are packed without bits, that are zero
+        // in all of them: `shift` trailing ones are dropped,
+        // leading ones are above `shift + width`
+        unsigned width;
+        unsigned shift;
+        std::vector<std::uint64_t> words;
+    };
+
+public:
+
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Forward iterator, that decodes
+     * values sequentially.
+     */
+    class const_iterator
+    {
+        template<typename, std::size_t, std::size_t>
+        friend class compressed_ringbuffer;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+
+        using value_type = T;
+
+        using difference_type = std::ptrdiff_t;
+
+        using pointer = const T*;
+
+        // Values are decoded on the fly
+        using reference = T;
+
+        const_iterator() :
+            m_owner(nullptr),
+            m_block(0),
+            m_position(0),
+            m_bits(0)
+        {
+
+        }
+
+        const_iterator& operator++()
+        {
+            ++m_position;
+
+            if (m_block < m_owner->m_blockCount)
+            {
+                if (m_position < BlockSize)
+                {
+                    const auto& current = m_owner->sealed(m_block);
+
+                    m_bits = codec::decode(
+                        m_bits,
+                        unpack(current.words.data(), current.width, m_position - 1) << current.shift
+                    );
+
+                    return *this;
+                }
+
+                ++m_block;
+                m_position = 0;
+            }
+
+            load();
+
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator retval = *this;
+
+            ++(*this);
+
+            return retval;
+        }
+
+        value_type operator*() const
+        {
+            return codec::from_bits(m_bits);
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return m_owner == other.m_owner &&
+                   m_block == other.m_block &&
+                   m_position == other.m_position;
+        }
+
+        bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        const_iterator(const compressed_ringbuffer* owner,
+                       size_type block,
+                       size_type position) :
+            m_owner(owner),
+            m_block(block),
+            m_position(position),
+            m_bits(0)
+        {
+            load();
+        }
+
+        void load()
+        {
+            if (m_block < m_owner->m_blockCount)
+            {
+                m_bits = m_owner->sealed(m_block).base;
+            }
+            else if (m_position < m_owner->m_openCount)
+            {
+                m_bits = codec::to_bits(m_owner->m_open[m_position]);
+            }
+        }
+
+        const compressed_ringbuffer* m_owner;
+        size_type m_block;
+        size_type m_position;
+        std::uint64_t m_bits;
+    };
+
+    using iterator = const_iterator;
+
+    /**
+     * @brief Default constructor.
+     */
+    compressed_ringbuffer() :
+        m_blocks(),
+        m_blockCount(0),
+        m_beginBlock(0),
+        m_open(),
+        m_openCount(0)
+    {
+
+    }
+
+    /**
+     * @brief Method for pushing back value.
+     * If open block is filled, it's sealed and
+     * oldest sealed block may be evicted.
+     * @param value Value.
+     */
+    void push_back(value_type value)
+    {
+        m_open[m_openCount++] = value;
+
+        if (m_openCount == BlockSize)
+        {
+            seal();
+        }
+    }
+
+    /**
+     * @brief Method for evicting oldest block.
+     * If there is no sealed blocks, open block is
+     * cleared.
+     */
+    void pop_front_block()
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        if (m_blockCount == 0)
+        {
+            m_openCount = 0;
+            return;
+        }
+
+        m_beginBlock = (m_beginBlock + 1) % BlockCount;
+        --m_blockCount;
+    }
+
+    /**
+     * @brief Method for getting first value.
+     * Throws `std::overflow_error` if container is empty.
+     * @return Oldest value.
+     */
+    value_type front() const
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        return *begin();
+    }
+
+    /**
+     * @brief Method for getting last value.
+     * Throws `std::overflow_error` if container is empty.
+     * @return Newest value.
+     */
+    value_type back() const
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        if (m_openCount != 0)
+        {
+            return m_open[m_openCount - 1];
+        }
+
+        const auto& last = sealed(m_blockCount - 1);
+
+        auto bits = last.base;
+
+        for (size_type i = 0; i < BlockSize - 1; ++i)
+        {
+            bits = codec::decode(bits, unpack(last.words.data(), last.width, i) << last.shift);
+        }
+
+        return codec::from_bits(bits);
+    }
+
+    /**
+     * @brief Method for traversing all values.
+     * Blocks are decoded with tight loop, so it's
+     * faster than iterator based traversal.
+     * @tparam Function Callable with `void(value_type)` signature.
+     * @param function Function.
+     */
+    template<typename Function>
+    void for_each(Function function) const
+    {
+        for (size_type index = 0; index < m_blockCount; ++index)
+        {
+            const auto& current = sealed(index);
+            const auto* words = current.words.data();
+            const auto width = current.width;
+            const auto shift = current.shift;
+
+            auto bits = current.base;
+
+            function(codec::from_bits(bits));
+
+            for (size_type i = 0; i < BlockSize - 1; ++i)
+            {
+                bits = codec::decode(bits, unpack(words, width, i) << shift);
+
+                function(codec::from_bits(bits));
+            }
+        }
+
+        for (size_type i = 0; i < m_openCount; ++i)
+        {
+            function(m_open[i]);
+        }
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0, 0);
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, m_blockCount, m_openCount);
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+    /**
+     * @brief Method for getting number of values.
+     * @return Number of values.
+     */
+    size_type size() const
+    {
+        return m_blockCount * BlockSize + m_openCount;
+    }
+
+    /**
+     * @brief Return maximum size.
+     * @return Returns the maximum number of values, that
+     * can be stored (sealed blocks and almost full open block).
+     */
+    size_type max_size() const
+    {
+        return BlockCount * BlockSize + BlockSize - 1;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Method for getting number of sealed blocks.
+     */
+    size_type block_count() const
+    {
+        return m_blockCount;
+    }
+
+    /**
+     * @brief Method for getting number of bytes,
+     * used by this object (including packed blocks storage).
+     */
+    size_type memory_usage() const
+    {
+        size_type result = sizeof(*this);
+
+        for (auto&& current : m_blocks)
+        {
+            result += current.words.capacity() * sizeof(std::uint64_t);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Method for clearing container.
+     * Packed storage is kept for reuse.
+     */
+    void clear()
+    {
+        m_blockCount = 0;
+        m_beginBlock = 0;
+        m_openCount = 0;
+    }
+
+private:
+
+    static std::uint64_t unpack(const std::uint64_t* words,
+                                unsigned width,
+                                size_type index)
+    {
+        if (width == 0)
+        {
+            return 0;
+        }
+
+        auto bit = index * width;
+        auto word = bit / 64;
+        auto shift = bit % 64;
+
+        auto value = words[word] >> shift;
+
+        if (shift + width > 64)
+        {
+            value |= words[word + 1] << (64 - shift);
+        }
+
+        if (width < 64)
+        {
+            value &= (std::uint64_t(1) << width) - 1;
+        }
+
+        return value;
+    }
+
+    const block& sealed(size_type index) const
+    {
+        return m_blocks[(m_beginBlock + index) % BlockCount];
+    }
+
+    void seal()
+    {
+        if (m_blockCount == BlockCount)
+        {
+            m_beginBlock = (m_beginBlock + 1) % BlockCount;
+            --m_blockCount;
+        }
+
+        auto& target = m_blocks[(m_beginBlock + m_blockCount) % BlockCount];
+
+        std::uint64_t residuals[BlockSize - 1];
+        std::uint64_t accumulator = 0;
+
+        auto previous = codec::to_bits(m_open[0]);
+
+        for (size_type i = 1; i < BlockSize; ++i)
+        {
+            auto current = codec::to_bits(m_open[i]);
+
+            residuals[i - 1] = codec::encode(previous, current);
+            accumulator |= residuals[i - 1];
+
+            previous = current;
+        }
+
+        // Floating point residuals of close values have
+        // zero sign, exponent and high mantissa bits (leading)
+        // and zero low mantissa bits for short fractions
+        // (trailing), only bits between are packed
+        auto trailing = accumulator == 0 ? 0u : ringbuffer_detail::count_trailing_zeros(accumulator);
+        auto width = ringbuffer_detail::bit_width(accumulator >> trailing);
+
+        target.base = codec::to_bits(m_open[0]);
+        target.width = width;
+        target.shift = trailing;
+
+        // Capacity is kept between laps, so steady state
+        // doesn't allocate
+        target.words.assign(((BlockSize - 1) * width + 63) / 64, 0);
+
+        auto* words = target.words.data();
+
+        for (size_type i = 0; i < BlockSize - 1 && width != 0; ++i)
+        {
+            auto bit = i * width;
+            auto word = bit / 64;
+            auto shift = bit % 64;
+
+            auto residual = residuals[i] >> trailing;
+
+            words[word] |= residual << shift;
+
+            if (shift + width > 64)
+            {
+                words[word + 1] |= residual >> (64 - shift);
+            }
+        }
+
+        ++m_blockCount;
+        m_openCount = 0;
+    }
+
+    block m_blocks[BlockCount];
+    size_type m_blockCount;
+    size_type m_beginBlock;
+    value_type m_open[BlockSize];
+    size_type m_openCount;
+};
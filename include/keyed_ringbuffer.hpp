@@ -0,0 +1,280 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ringbuffer.hpp"
+#include "ringbuffer_bits.hpp"
+
+/**
+ * @brief Key extractor, that uses element itself as key.
+ */
+template<typename T>
+struct ringbuffer_identity_key
+{
+    const T& operator()(const T& value) const
+    {
+        return value;
+    }
+};
+
+/**
+ * @brief Class, that describes ringbuffer with hash
+ * index over stored elements. It's FIFO evicting cache:
+ * pushed element is inserted into index, overwritten
+ * or popped element is removed from it.
+ * Index is flat open addressing table with linear
+ * probing and backward shift deletion, it's allocated
+ * inline, so there is no per-insert allocation.
+ * If several stored elements have same key, `find`
+ * returns any of them.
+ * @tparam T Value type.
+ * @tparam Size Ringbuffer size.
+ * @tparam KeyOf Key extractor.
+ * @tparam Hash Key hash.
+ * @tparam KeyEqual Key equality.
+ */
+template<
+    typename T,
+    std::size_t Size,
+    typename KeyOf = ringbuffer_identity_key<T>,
+    typename Hash = std::hash<typename std::decay<decltype(std::declval<KeyOf>()(std::declval<const T&>()))>::type>,
+    typename KeyEqual = std::equal_to<typename std::decay<decltype(std::declval<KeyOf>()(std::declval<const T&>()))>::type>
+>
+class keyed_ringbuffer
+{
+    using index_type = std::uint32_t;
+
+    static_assert(Size < static_cast<std::size_t>(std::numeric_limits<index_type>::max()),
+                  "Ringbuffer is too large.");
+
+    static constexpr index_type Empty = std::numeric_limits<index_type>::max();
+
+    // Load factor is kept at most 0.5
+    static constexpr std::size_t TableBits = ringbuffer_detail::ceil_log2(Size * 2);
+
+    static constexpr std::size_t TableSize = std::size_t(1) << TableBits;
+
+public:
+
+    using value_type = T;
+
+    using key_type = typename std::decay<decltype(std::declval<KeyOf>()(std::declval<const T&>()))>::type;
+
+    using const_reference = const T&;
+
+    using size_type = std::size_t;
+
+    using const_iterator = typename ringbuffer<T, Size>::const_iterator;
+
+    /**
+     * @brief Default constructor.
+     */
+    keyed_ringbuffer() :
+        m_buffer(),
+        m_keyOf(),
+        m_hash(),
+        m_equal()
+    {
+        for (auto&& entry : m_table)
+        {
+            entry = Empty;
+        }
+    }
+
+    /**
+     * @brief Method for pushing back element.
+     * If ringbuffer is full, front element is evicted.
+     * @param value Value.
+     */
+    void push_back(const value_type& value)
+    {
+        if (m_buffer.size() == Size)
+        {
+            pop_front();
+        }
+
+        auto slot = static_cast<index_type>(m_buffer.slot_index(m_buffer.size()));
+
+        m_buffer.push_back(value);
+
+        auto hash = m_hash(m_keyOf(value));
+        m_hashes[slot] = hash;
+
+        auto position = home(hash);
+
+        while (m_table[position] != Empty)
+        {
+            position = (position + 1) & (TableSize - 1);
+        }
+
+        m_table[position] = slot;
+    }
+
+    /**
+     * @brief Method for popping element from front.
+     */
+    void pop_front()
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        auto slot = static_cast<index_type>(m_buffer.slot_index(0));
+
+        auto position = home(m_hashes[slot]);
+
+        while (m_table[position] != slot)
+        {
+            position = (position + 1) & (TableSize - 1);
+        }
+
+        erase_position(position);
+
+        m_buffer.pop_front();
+    }
+
+    /**
+     * @brief Method for checking if there is
+     * element with key.
+     * @param key Key.
+     */
+    bool contains(const key_type& key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Method for searching element by key.
+     * @param key Key.
+     * @return Pointer to element or nullptr if
+     * there is no element with this key.
+     */
+    const value_type* find(const key_type& key) const
+    {
+        auto hash = m_hash(key);
+        auto position = home(hash);
+
+        while (m_table[position] != Empty)
+        {
+            auto slot = m_table[position];
+
+            if (m_hashes[slot] == hash)
+            {
+                const auto& candidate = value(slot);
+
+                if (m_equal(m_keyOf(candidate), key))
+                {
+                    return &candidate;
+                }
+            }
+
+            position = (position + 1) & (TableSize - 1);
+        }
+
+        return nullptr;
+    }
+
+    const_reference front() const
+    {
+        return m_buffer.front();
+    }
+
+    const_reference back() const
+    {
+        return m_buffer.back();
+    }
+
+    const_reference operator[](size_type n) const
+    {
+        return m_buffer[n];
+    }
+
+    const_iterator begin() const
+    {
+        return m_buffer.begin();
+    }
+
+    const_iterator end() const
+    {
+        return m_buffer.end();
+    }
+
+    size_type size() const
+    {
+        return m_buffer.size();
+    }
+
+    size_type max_size() const
+    {
+        return Size;
+    }
+
+    bool empty() const
+    {
+        return m_buffer.empty();
+    }
+
+    /**
+     * @brief Method for clearing container.
+     */
+    void clear()
+    {
+        m_buffer.clear();
+
+        for (auto&& entry : m_table)
+        {
+            entry = Empty;
+        }
+    }
+
+private:
+
+    static std::size_t home(std::size_t hash)
+    {
+        // Fibonacci hashing, so weak hashes (like identity
+        // for integers) don't form long clusters
+        return static_cast<std::size_t>(
+            (static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> (64 - TableBits)
+        );
+    }
+
+    const_reference value(index_type slot) const
+    {
+        return m_buffer[m_buffer.element_index(slot)];
+    }
+
+    void erase_position(std::size_t position)
+    {
+        // Backward shift deletion: moving following entries
+        // of the cluster, that may be placed at freed position
+        auto hole = position;
+        auto next = (hole + 1) & (TableSize - 1);
+
+        while (m_table[next] != Empty)
+        {
+            auto desired = home(m_hashes[m_table[next]]);
+
+            // Entry may be moved if hole is between its home and it
+            if (((next - desired) & (TableSize - 1)) >= ((next - hole) & (TableSize - 1)))
+            {
+                m_table[hole] = m_table[next];
+                hole = next;
+            }
+
+            next = (next + 1) & (TableSize - 1);
+        }
+
+        m_table[hole] = Empty;
+    }
+
+    ringbuffer<T, Size> m_buffer;
+    index_type m_table[TableSize];
+    std::size_t m_hashes[Size];
+    KeyOf m_keyOf;
+    Hash m_hash;
+    KeyEqual m_equal;
+};
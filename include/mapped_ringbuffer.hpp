@@ -0,0 +1,318 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <system_error>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+/**
+ * @brief Options for placing large ringbuffers into
+ * directly mapped memory.
+ */
+struct ringbuffer_mapping_options
+{
+    ringbuffer_mapping_options() :
+        huge_pages(false),
+        numa_node(-1),
+        lock(false),
+        prefault(false)
+    {
+
+    }
+
+    /**
+     * @brief Try to use explicit huge pages (`MAP_HUGETLB`)
+     * and fall back to transparent huge pages hint.
+     */
+    bool huge_pages;
+
+    /**
+     * @brief NUMA node to bind memory to. Negative value
+     * means no binding (first touch policy).
+     */
+    int numa_node;
+
+    /**
+     * @brief Lock pages in memory (`mlock`).
+     * Throws `std::system_error` if it's not permitted.
+     */
+    bool lock;
+
+    /**
+     * @brief Fault all pages before construction, so first
+     * lap doesn't take page faults.
+     */
+    bool prefault;
+};
+
+/**
+ * @brief Deleter for ringbuffers, created with
+ * `make_mapped_ringbuffer`. Also describes which
+ * of requested options were actually applied.
+ * @tparam Ringbuffer Ringbuffer type.
+ */
+template<typename Ringbuffer>
+class ringbuffer_mapping_deleter
+{
+    template<typename R, typename... Args>
+    friend std::unique_ptr<R, ringbuffer_mapping_deleter<R>>
+    make_mapped_ringbuffer(const ringbuffer_mapping_options&, Args&&...);
+
+public:
+    ringbuffer_mapping_deleter() :
+        m_length(0),
+        m_explicitHugePages(false),
+        m_transparentHugePages(false),
+        m_numaBound(false),
+        m_locked(false)
+    {
+
+    }
+
+    void operator()(Ringbuffer* pointer) const
+    {
+        if (pointer == nullptr)
+        {
+            return;
+        }
+
+        pointer->~Ringbuffer();
+
+#if defined(__linux__)
+        if (m_locked)
+        {
+            munlock(pointer, m_length);
+        }
+
+        munmap(pointer, m_length);
+#else
+        std::free(pointer);
+#endif
+    }
+
+    /**
+     * @brief Number of mapped bytes.
+     */
+    std::size_t mapped_length() const
+    {
+        return m_length;
+    }
+
+    /**
+     * @brief Is memory mapped with `MAP_HUGETLB`.
+     */
+    bool explicit_huge_pages() const
+    {
+        return m_explicitHugePages;
+    }
+
+    /**
+     * @brief Is memory advised with `MADV_HUGEPAGE`.
+     */
+    bool transparent_huge_pages() const
+    {
+        return m_transparentHugePages;
+    }
+
+    /**
+     * @brief Is memory bound to requested NUMA node.
+     */
+    bool numa_bound() const
+    {
+        return m_numaBound;
+    }
+
+    /**
+     * @brief Is memory locked.
+     */
+    bool locked() const
+    {
+        return m_locked;
+    }
+
+private:
+    std::size_t m_length;
+    bool m_explicitHugePages;
+    bool m_transparentHugePages;
+    bool m_numaBound;
+    bool m_locked;
+};
+
+template<typename Ringbuffer>
+using mapped_ringbuffer_ptr = std::unique_ptr<Ringbuffer, ringbuffer_mapping_deleter<Ringbuffer>>;
+
+/**
+ * @brief Function for creating ringbuffer in directly
+ * mapped memory. It's meant for multi-gigabyte ringbuffers,
+ * where TLB misses and remote NUMA memory are noticeable.
+ * Options, that can't be applied on this system
+ * (huge pages, NUMA binding) are silently skipped, check
+ * deleter to find out what was applied.
+ * @tparam Ringbuffer Ringbuffer type.
+ * @tparam Args Constructor argument types.
+ * @param options Mapping options.
+ * @param args Constructor arguments.
+ * @return Owning pointer to constructed ringbuffer.
+ */
+template<typename Ringbuffer, typename... Args>
+std::unique_ptr<Ringbuffer, ringbuffer_mapping_deleter<Ringbuffer>>
+make_mapped_ringbuffer(const ringbuffer_mapping_options& options, Args&&... args)
+{
+    ringbuffer_mapping_deleter<Ringbuffer> deleter;
+
+#if defined(__linux__)
+    static const std::size_t HugePageSize = 2u * 1024u * 1024u;
+
+    auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    auto granularity = options.huge_pages ? HugePageSize : pageSize;
+
+    deleter.m_length = (sizeof(Ringbuffer) + granularity - 1) / granularity * granularity;
+
+    void* memory = MAP_FAILED;
+
+    auto flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    if (options.huge_pages)
+    {
+        memory = mmap(nullptr, deleter.m_length, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+
+        deleter.m_explicitHugePages = memory != MAP_FAILED;
+    }
+
+    if (memory == MAP_FAILED && options.huge_pages)
+    {
+        // Transparent huge pages are used only for 2 MiB
+        // aligned ranges, so mapping is over-allocated and
+        // trimmed to aligned part
+        auto length = deleter.m_length + HugePageSize;
+        auto* raw = static_cast<char*>(mmap(nullptr, length, PROT_READ | PROT_WRITE, flags, -1, 0));
+
+        if (raw != MAP_FAILED)
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(raw);
+            auto* aligned = raw + ((HugePageSize - address % HugePageSize) % HugePageSize);
+            auto* tail = aligned + deleter.m_length;
+
+            if (aligned != raw)
+            {
+                munmap(raw, static_cast<std::size_t>(aligned - raw));
+            }
+
+            if (tail != raw + length)
+            {
+                munmap(tail, static_cast<std::size_t>(raw + length - tail));
+            }
+
+            memory = aligned;
+        }
+    }
+    else if (memory == MAP_FAILED)
+    {
+        memory = mmap(nullptr, deleter.m_length, PROT_READ | PROT_WRITE, flags, -1, 0);
+    }
+
+    if (memory == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+#if defined(MADV_HUGEPAGE)
+    if (options.huge_pages && !deleter.m_explicitHugePages)
+    {
+        deleter.m_transparentHugePages =
+            madvise(memory, deleter.m_length, MADV_HUGEPAGE) == 0;
+    }
+#endif
+
+#if defined(SYS_mbind)
+    if (options.numa_node >= 0 &&
+        options.numa_node < static_cast<int>(sizeof(unsigned long) * 8))
+    {
+        static const int BindPolicy = 2; // MPOL_BIND
+
+        unsigned long nodeMask = 1ul << options.numa_node;
+
+        deleter.m_numaBound = syscall(
+            SYS_mbind,
+            memory,
+            deleter.m_length,
+            BindPolicy,
+            &nodeMask,
+            sizeof(unsigned long) * 8,
+            0
+        ) == 0;
+    }
+#endif
+
+    // Touching pages after huge page hint and binding
+    // (instead of `MAP_POPULATE`), so faulted pages are huge
+    // and placed on requested node
+    if (options.prefault)
+    {
+        auto step = deleter.m_explicitHugePages ? HugePageSize : pageSize;
+        auto* bytes = static_cast<volatile char*>(memory);
+
+        for (std::size_t offset = 0; offset < deleter.m_length; offset += step)
+        {
+            bytes[offset] = 0;
+        }
+    }
+
+    if (options.lock)
+    {
+        if (mlock(memory, deleter.m_length) != 0)
+        {
+            auto error = errno;
+            munmap(memory, deleter.m_length);
+
+            throw std::system_error(error, std::generic_category(), "Can't lock ringbuffer memory");
+        }
+
+        deleter.m_locked = true;
+    }
+#else
+    (void) options;
+
+    deleter.m_length = sizeof(Ringbuffer);
+
+    void* memory = std::malloc(deleter.m_length);
+
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+#endif
+
+    Ringbuffer* pointer = nullptr;
+
+    try
+    {
+        pointer = new (memory) Ringbuffer(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+#if defined(__linux__)
+        if (deleter.m_locked)
+        {
+            munlock(memory, deleter.m_length);
+        }
+
+        munmap(memory, deleter.m_length);
+#else
+        std::free(memory);
+#endif
+        throw;
+    }
+
+    return std::unique_ptr<Ringbuffer, ringbuffer_mapping_deleter<Ringbuffer>>(pointer, deleter);
+}
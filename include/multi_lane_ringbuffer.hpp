@@ -0,0 +1,269 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "ringbuffer.hpp"
+#include "ringbuffer_bits.hpp"
+
+/**
+ * @brief Policy for choosing lane of next dequeued element.
+ */
+enum class ringbuffer_lane_policy
+{
+    strict_priority,     ///< Lowest non empty lane always goes first.
+    deficit_round_robin  ///< Lanes are served in turn, up to their weights.
+};
+
+/**
+ * @brief Class, that describes queue, multiplexed over
+ * several lanes (one ringbuffer per lane). Lane 0 has
+ * highest priority. Non empty lanes are tracked in bitmap,
+ * so choosing lane is O(1) regardless of lane sizes.
+ * Like `ringbuffer` each lane overwrites its oldest
+ * element, when full, so bursts in one lane don't
+ * take space of others.
+ * @tparam T Value type.
+ * @tparam LaneSize Size of every lane.
+ * @tparam LaneCount Number of lanes (up to 64).
+ */
+template<typename T, std::size_t LaneSize, std::size_t LaneCount>
+class multi_lane_ringbuffer
+{
+    static_assert(LaneCount > 0 && LaneCount <= 64, "Lane count must be in [1, 64] range.");
+
+public:
+
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    using lane_type = ringbuffer<T, LaneSize>;
+
+    using weights_type = std::array<size_type, LaneCount>;
+
+    /**
+     * @brief Constructor.
+     * @param policy Dequeue policy.
+     * @param weights Number of elements, taken from lane
+     * per round with `deficit_round_robin` policy. Every
+     * weight must be positive.
+     */
+    explicit multi_lane_ringbuffer(ringbuffer_lane_policy policy = ringbuffer_lane_policy::strict_priority,
+                                   const weights_type& weights = default_weights()) :
+        m_lanes(),
+        m_nonEmpty(0),
+        m_policy(policy),
+        m_weights(weights),
+        m_deficits(),
+        m_current(LaneCount - 1)
+    {
+        for (auto weight : m_weights)
+        {
+            if (weight == 0)
+            {
+                throw std::invalid_argument("Lane weight must be positive.");
+            }
+        }
+
+        m_deficits.fill(0);
+    }
+
+    /**
+     * @brief Method for pushing element into lane.
+     * @param lane Lane index.
+     * @param value Value.
+     */
+    void push_back(size_type lane, const value_type& value)
+    {
+        lane_at(lane).push_back(value);
+        m_nonEmpty |= std::uint64_t(1) << lane;
+    }
+
+    /**
+     * @brief Method for constructing element in lane.
+     * @param lane Lane index.
+     * @param args Constructor arguments.
+     */
+    template<typename... Args>
+    void emplace_back(size_type lane, Args&&... args)
+    {
+        lane_at(lane).emplace_back(std::forward<Args>(args)...);
+        m_nonEmpty |= std::uint64_t(1) << lane;
+    }
+
+    /**
+     * @brief Method for taking next element
+     * according to policy.
+     * @param value Taken value.
+     * @return False if all lanes are empty.
+     */
+    bool pop_front(value_type& value)
+    {
+        return drain([&value](size_type, value_type& el) { value = std::move(el); }, 1) != 0;
+    }
+
+    /**
+     * @brief Method for taking several elements across
+     * lanes according to policy. Runs of elements from
+     * one lane are passed without choosing lane again.
+     * Function must not modify container.
+     * @tparam Function Callable with `void(size_type lane, value_type&)` signature.
+     * @param function Function.
+     * @param batch Maximum number of elements.
+     * @return Number of taken elements.
+     */
+    template<typename Function>
+    size_type drain(Function function, size_type batch = LaneSize * LaneCount)
+    {
+        size_type result = 0;
+
+        while (result < batch && m_nonEmpty != 0)
+        {
+            auto lane = select_lane();
+            auto& buffer = m_lanes[lane];
+            auto count = std::min(batch - result, buffer.size());
+
+            if (m_policy == ringbuffer_lane_policy::deficit_round_robin)
+            {
+                count = std::min(count, m_deficits[lane]);
+                m_deficits[lane] -= count;
+            }
+
+            buffer.view().subspan(0, count).for_each([&function, lane](value_type& el)
+            {
+                function(lane, el);
+            });
+
+            buffer.pop_front(count);
+            result += count;
+
+            if (buffer.empty())
+            {
+                m_nonEmpty &= ~(std::uint64_t(1) << lane);
+
+                // Empty lane doesn't keep unused share
+                m_deficits[lane] = 0;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Method for getting lane, that will be
+     * served next by strict priority (lowest non empty).
+     * @return Lane index or `LaneCount` if all lanes are empty.
+     */
+    size_type top_lane() const
+    {
+        return m_nonEmpty == 0 ? LaneCount : ringbuffer_detail::count_trailing_zeros(m_nonEmpty);
+    }
+
+    const lane_type& lane(size_type index) const
+    {
+        if (index >= LaneCount)
+        {
+            throw std::out_of_range("Index is out of range.");
+        }
+
+        return m_lanes[index];
+    }
+
+    size_type size() const
+    {
+        size_type result = 0;
+
+        for (auto&& buffer : m_lanes)
+        {
+            result += buffer.size();
+        }
+
+        return result;
+    }
+
+    bool empty() const
+    {
+        return m_nonEmpty == 0;
+    }
+
+    static constexpr size_type lane_count()
+    {
+        return LaneCount;
+    }
+
+    ringbuffer_lane_policy policy() const
+    {
+        return m_policy;
+    }
+
+    /**
+     * @brief Method for clearing all lanes.
+     */
+    void clear()
+    {
+        for (auto&& buffer : m_lanes)
+        {
+            buffer.clear();
+        }
+
+        m_nonEmpty = 0;
+        m_deficits.fill(0);
+    }
+
+private:
+
+    static weights_type default_weights()
+    {
+        weights_type result;
+        result.fill(1);
+
+        return result;
+    }
+
+    lane_type& lane_at(size_type index)
+    {
+        if (index >= LaneCount)
+        {
+            throw std::out_of_range("Index is out of range.");
+        }
+
+        return m_lanes[index];
+    }
+
+    /**
+     * @brief Method for choosing lane, that is served next.
+     * There must be non empty lane.
+     */
+    size_type select_lane()
+    {
+        if (m_policy == ringbuffer_lane_policy::strict_priority)
+        {
+            return ringbuffer_detail::count_trailing_zeros(m_nonEmpty);
+        }
+
+        if ((m_nonEmpty >> m_current & 1) != 0 && m_deficits[m_current] != 0)
+        {
+            return m_current;
+        }
+
+        // Next non empty lane after current one (cyclic)
+        auto after = m_current + 1 < 64 ? m_nonEmpty & ~((std::uint64_t(1) << (m_current + 1)) - 1) : 0;
+
+        m_current = ringbuffer_detail::count_trailing_zeros(after != 0 ? after : m_nonEmpty);
+        m_deficits[m_current] += m_weights[m_current];
+
+        return m_current;
+    }
+
+    std::array<lane_type, LaneCount> m_lanes;
+    std::uint64_t m_nonEmpty;
+    const ringbuffer_lane_policy m_policy;
+    const weights_type m_weights;
+    weights_type m_deficits;
+    size_type m_current;
+};
@@ -0,0 +1,392 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Class, that describes ringbuffer with order
+ * statistics over stored window (rolling median,
+ * percentiles, ranks).
+ * Elements are additionally linked into treap, ordered by
+ * value. Treap nodes are preallocated, one per ringbuffer
+ * slot, so updates don't allocate. Push, eviction and
+ * queries take O(log n) expected time.
+ * @tparam T Value type.
+ * @tparam Size Ringbuffer size.
+ * @tparam Compare Value ordering.
+ */
+template<typename T, std::size_t Size, typename Compare = std::less<T>>
+class order_statistics_ringbuffer
+{
+    using index_type = std::uint32_t;
+
+    static_assert(Size < static_cast<std::size_t>(std::numeric_limits<index_type>::max()),
+                  "Ringbuffer is too large.");
+
+    static constexpr index_type Null = static_cast<index_type>(Size);
+
+public:
+
+    using value_type = T;
+
+    using const_reference = const T&;
+
+    using size_type = std::size_t;
+
+    using const_iterator = typename ringbuffer<T, Size>::const_iterator;
+
+    /**
+     * @brief Default constructor.
+     * @param compare Comparator.
+     */
+    explicit order_statistics_ringbuffer(const Compare& compare = Compare()) :
+        m_buffer(),
+        m_compare(compare),
+        m_root(Null),
+        m_sequence(0),
+        m_random(0x9E3779B9u)
+    {
+
+    }
+
+    /**
+     * @brief Method for pushing back element.
+     * If ringbuffer is full, front element is evicted.
+     * @param value Value.
+     */
+    void push_back(const value_type& value)
+    {
+        if (m_buffer.size() == Size)
+        {
+            pop_front();
+        }
+
+        auto node = static_cast<index_type>(m_buffer.slot_index(m_buffer.size()));
+
+        m_buffer.push_back(value);
+
+        m_nodes[node].left = Null;
+        m_nodes[node].right = Null;
+        m_nodes[node].count = 1;
+        m_nodes[node].priority = next_priority();
+        m_nodes[node].sequence = m_sequence++;
+
+        index_type left;
+        index_type right;
+
+        split(m_root, node, left, right);
+
+        m_root = merge(merge(left, node), right);
+    }
+
+    /**
+     * @brief Method for popping element from front.
+     */
+    void pop_front()
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        auto node = static_cast<index_type>(m_buffer.slot_index(0));
+
+        index_type left;
+        index_type right;
+        index_type removed;
+
+        split(m_root, node, left, right);
+        split_first(right, removed, right);
+
+        m_root = merge(left, right);
+
+        m_buffer.pop_front();
+    }
+
+    /**
+     * @brief Method for getting n-th smallest element.
+     * @param n Zero based rank.
+     * @return Element, that has n elements before it
+     * in sorted order.
+     */
+    const_reference nth_smallest(size_type n) const
+    {
+        if (n >= size())
+        {
+            throw std::out_of_range("Index is out of range.");
+        }
+
+        auto node = m_root;
+
+        while (true)
+        {
+            auto leftCount = count(m_nodes[node].left);
+
+            if (n < leftCount)
+            {
+                node = m_nodes[node].left;
+            }
+            else if (n == leftCount)
+            {
+                return value(node);
+            }
+            else
+            {
+                n -= leftCount + 1;
+                node = m_nodes[node].right;
+            }
+        }
+    }
+
+    /**
+     * @brief Method for getting number of stored
+     * elements, that are less than value.
+     * @param value Value.
+     * @return Rank of value.
+     */
+    size_type rank(const value_type& value) const
+    {
+        size_type result = 0;
+
+        auto node = m_root;
+
+        while (node != Null)
+        {
+            if (m_compare(this->value(node), value))
+            {
+                result += count(m_nodes[node].left) + 1;
+                node = m_nodes[node].right;
+            }
+            else
+            {
+                node = m_nodes[node].left;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Method for getting percentile of stored
+     * elements (nearest rank, without interpolation).
+     * @param fraction Percentile in [0, 1] range (0.99 for p99).
+     * @return Element.
+     */
+    const_reference percentile(double fraction) const
+    {
+        if (empty())
+        {
+            throw std::out_of_range("There is no elements.");
+        }
+
+        if (fraction <= 0.0)
+        {
+            return nth_smallest(0);
+        }
+
+        if (fraction >= 1.0)
+        {
+            return nth_smallest(size() - 1);
+        }
+
+        return nth_smallest(static_cast<size_type>(fraction * (size() - 1) + 0.5));
+    }
+
+    /**
+     * @brief Method for getting median (lower one
+     * for even number of elements).
+     */
+    const_reference median() const
+    {
+        if (empty())
+        {
+            throw std::out_of_range("There is no elements.");
+        }
+
+        return nth_smallest((size() - 1) / 2);
+    }
+
+    const_reference front() const
+    {
+        return m_buffer.front();
+    }
+
+    const_reference back() const
+    {
+        return m_buffer.back();
+    }
+
+    const_reference operator[](size_type n) const
+    {
+        return m_buffer[n];
+    }
+
+    const_iterator begin() const
+    {
+        return m_buffer.begin();
+    }
+
+    const_iterator end() const
+    {
+        return m_buffer.end();
+    }
+
+    size_type size() const
+    {
+        return m_buffer.size();
+    }
+
+    size_type max_size() const
+    {
+        return Size;
+    }
+
+    bool empty() const
+    {
+        return m_buffer.empty();
+    }
+
+    /**
+     * @brief Method for clearing container.
+     */
+    void clear()
+    {
+        m_buffer.clear();
+        m_root = Null;
+    }
+
+private:
+
+    struct node
+    {
+        index_type left;
+        index_type right;
+        index_type count;
+        std::uint32_t priority;
+        std::uint64_t sequence;
+    };
+
+    const_reference value(index_type node) const
+    {
+        return m_buffer[m_buffer.element_index(node)];
+    }
+
+    size_type count(index_type node) const
+    {
+        return node == Null ? 0 : m_nodes[node].count;
+    }
+
+    void update(index_type node)
+    {
+        m_nodes[node].count = static_cast<index_type>(
+            count(m_nodes[node].left) + count(m_nodes[node].right) + 1
+        );
+    }
+
+    bool less(index_type lhs, index_type rhs) const
+    {
+        if (m_compare(value(lhs), value(rhs)))
+        {
+            return true;
+        }
+
+        if (m_compare(value(rhs), value(lhs)))
+        {
+            return false;
+        }
+
+        // Equal values are ordered by insertion
+        return m_nodes[lhs].sequence < m_nodes[rhs].sequence;
+    }
+
+    /**
+     * @brief Splits tree into nodes, that are less
+     * than key node, and others.
+     */
+    void split(index_type root, index_type key, index_type& left, index_type& right)
+    {
+        if (root == Null)
+        {
+            left = Null;
+            right = Null;
+            return;
+        }
+
+        if (less(root, key))
+        {
+            split(m_nodes[root].right, key, m_nodes[root].right, right);
+            left = root;
+        }
+        else
+        {
+            split(m_nodes[root].left, key, left, m_nodes[root].left);
+            right = root;
+        }
+
+        update(root);
+    }
+
+    /**
+     * @brief Splits off the smallest node.
+     */
+    void split_first(index_type root, index_type& first, index_type& rest)
+    {
+        if (m_nodes[root].left == Null)
+        {
+            first = root;
+            rest = m_nodes[root].right;
+            m_nodes[root].right = Null;
+            update(root);
+            return;
+        }
+
+        split_first(m_nodes[root].left, first, m_nodes[root].left);
+        rest = root;
+
+        update(root);
+    }
+
+    index_type merge(index_type left, index_type right)
+    {
+        if (left == Null)
+        {
+            return right;
+        }
+
+        if (right == Null)
+        {
+            return left;
+        }
+
+        if (m_nodes[left].priority > m_nodes[right].priority)
+        {
+            m_nodes[left].right = merge(m_nodes[left].right, right);
+            update(left);
+            return left;
+        }
+
+        m_nodes[right].left = merge(left, m_nodes[right].left);
+        update(right);
+        return right;
+    }
+
+    std::uint32_t next_priority()
+    {
+        // xorshift32
+        m_random ^= m_random << 13;
+        m_random ^= m_random >> 17;
+        m_random ^= m_random << 5;
+
+        return m_random;
+    }
+
+    ringbuffer<T, Size> m_buffer;
+    Compare m_compare;
+    node m_nodes[Size];
+    index_type m_root;
+    std::uint64_t m_sequence;
+    std::uint32_t m_random;
+};
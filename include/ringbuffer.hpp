@@ -1,12 +1,30 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <iterator>
 #include <memory>
 #include <limits>
 #include <sstream>
+#include <type_traits>
 #include <iostream>
 #include <iomanip>
 
+#include "ringbuffer_view.hpp"
+
+/**
+ * @brief Core ringbuffer operations (construction, push,
+ * pop, element access and iteration) are usable in
+ * constant expressions since C++20.
+ */
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201907L
+#define RINGBUFFER_CONSTEXPR constexpr
+#else
+#define RINGBUFFER_CONSTEXPR
+#endif
+
 /**
  * @brief Class, that describes classic ringbuffer
  * data structure.
@@ -29,6 +47,20 @@ public:
 
     using size_type = std::size_t;
 
+    /**
+     * @brief Contiguous part of ringbuffer storage.
+     */
+    template<typename Pointer>
+    struct basic_segment
+    {
+        Pointer data;
+        size_type size;
+    };
+
+    using segment = basic_segment<value_type*>;
+
+    using const_segment = basic_segment<const value_type*>;
+
     /**
      * @brief Iterator type.
      */
@@ -44,7 +76,7 @@ public:
         friend class ringbuffer;
 
     public:
-        explicit iterator(T* val,
+        RINGBUFFER_CONSTEXPR explicit iterator(T* val,
                           size_type begin,
                           size_type fromBegin) :
             m_buffer(val),
@@ -55,7 +87,7 @@ public:
 
         }
 
-        iterator& operator++()
+        RINGBUFFER_CONSTEXPR iterator& operator++()
         {
             m_currentPos = (m_currentPos + 1) % Size;
 
@@ -79,7 +111,7 @@ public:
             return *this;
         }
 
-        iterator operator+(size_type val)
+        RINGBUFFER_CONSTEXPR iterator operator+(size_type val)
         {
             iterator copy = *this;
 
@@ -107,7 +139,7 @@ public:
             return copy;
         }
 
-        iterator operator-(size_type val)
+        RINGBUFFER_CONSTEXPR iterator operator-(size_type val)
         {
             iterator copy = *this;
 
@@ -140,7 +172,7 @@ public:
             return copy;
         }
 
-        iterator operator++(int)
+        RINGBUFFER_CONSTEXPR iterator operator++(int)
         {
             iterator retval = *this;
 
@@ -149,7 +181,7 @@ public:
             return retval;
         }
 
-        iterator& operator--()
+        RINGBUFFER_CONSTEXPR iterator& operator--()
         {
             if (m_currentPos == 0)
             {
@@ -180,7 +212,7 @@ public:
             return *this;
         }
 
-        iterator operator--(int)
+        RINGBUFFER_CONSTEXPR iterator operator--(int)
         {
             iterator retval = *this;
 
@@ -190,7 +222,7 @@ public:
         }
 
         // todo: optimize this
-        iterator operator+(size_type value) const
+        RINGBUFFER_CONSTEXPR iterator operator+(size_type value) const
         {
             iterator retval = *this;
 
@@ -198,14 +230,14 @@ public:
         }
 
         // todo: optimize this
-        iterator operator-(size_type value) const
+        RINGBUFFER_CONSTEXPR iterator operator-(size_type value) const
         {
             iterator retval = *this;
 
             return retval - value;
         }
 
-        bool operator==(iterator other) const
+        RINGBUFFER_CONSTEXPR bool operator==(iterator other) const
         {
             auto equality =
                    m_buffer == other.m_buffer &&
@@ -221,17 +253,17 @@ public:
             }
         }
 
-        bool operator!=(iterator other) const
+        RINGBUFFER_CONSTEXPR bool operator!=(iterator other) const
         {
             return !(*this == other);
         }
 
-        reference operator*()
+        RINGBUFFER_CONSTEXPR reference operator*()
         {
             return *(m_buffer + m_currentPos);
         }
 
-        const_reference operator*() const
+        RINGBUFFER_CONSTEXPR const_reference operator*() const
         {
             return *(m_buffer + m_currentPos);
         }
@@ -252,10 +284,9 @@ public:
     /**
      * @brief Default constructor.
      */
-    ringbuffer() :
+    RINGBUFFER_CONSTEXPR ringbuffer() :
         m_buffer(),
         m_length(0),
-        m_insertPosition(0),
         m_beginPosition(0)
     {
 
@@ -269,11 +300,10 @@ public:
      * @param val Fill element value.
      * @param alloc Allocator.
      */
-    explicit ringbuffer(size_type n,
+    RINGBUFFER_CONSTEXPR explicit ringbuffer(size_type n,
                         const value_type& val = value_type()) :
         m_buffer(),
-        m_length(n),
-        m_insertPosition(0),
+        m_length(static_cast<index_type>(n)),
         m_beginPosition(0)
     {
         auto* pointer = m_buffer;
@@ -294,11 +324,10 @@ public:
      * @param alloc Allocator.
      */
     template<typename InputIterator>
-     ringbuffer(InputIterator first,
+    RINGBUFFER_CONSTEXPR ringbuffer(InputIterator first,
                 InputIterator last) :
         m_buffer(),
-        m_length(static_cast<size_type>(std::distance(first, last))),
-        m_insertPosition(0),
+        m_length(static_cast<index_type>(std::distance(first, last))),
         m_beginPosition(0)
     {
         for (auto* pointer = m_buffer; first != last; ++first)
@@ -307,10 +336,9 @@ public:
         }
     }
 
-    ringbuffer& operator=(ringbuffer&& x) noexcept
+    RINGBUFFER_CONSTEXPR ringbuffer& operator=(ringbuffer&& x) noexcept
     {
         m_length = std::move(x.m_length);
-        m_insertPosition = std::move(x.m_insertPosition);
         m_beginPosition = std::move(x.m_beginPosition);
 
         auto* pointer = m_buffer;
@@ -321,18 +349,18 @@ public:
         }
 
         x.m_length = 0;
-        x.m_insertPosition = 0;
         x.m_beginPosition = 0;
+
+        return *this;
     }
 
     /**
      * @brief Move constructor.
      * @param x Rhs.
      */
-    ringbuffer(ringbuffer&& x) noexcept :
+    RINGBUFFER_CONSTEXPR ringbuffer(ringbuffer&& x) noexcept :
         m_buffer(),
         m_length(std::move(x.m_length)),
-        m_insertPosition(std::move(x.m_insertPosition)),
         m_beginPosition(std::move(x.m_beginPosition))
     {
         auto* pointer = m_buffer;
@@ -342,7 +370,6 @@ public:
         }
 
         x.m_length = 0;
-        x.m_insertPosition = 0;
         x.m_beginPosition = 0;
     }
 
@@ -351,10 +378,9 @@ public:
      * @param list Initializer list.
      * @param alloc Allocator.
      */
-    ringbuffer(std::initializer_list<value_type> list) :
+    RINGBUFFER_CONSTEXPR ringbuffer(std::initializer_list<value_type> list) :
         m_buffer(),
-        m_length(static_cast<size_type>(std::distance(list.begin(), list.end()))),
-        m_insertPosition(0),
+        m_length(static_cast<index_type>(list.size())),
         m_beginPosition(0)
     {
         auto* pointer = m_buffer;
@@ -369,7 +395,7 @@ public:
      * @return Returns an iterator pointing
      * to the first element in the ring buffer.
      */
-    iterator begin()
+    RINGBUFFER_CONSTEXPR iterator begin()
     {
         return iterator(m_buffer,
                         m_beginPosition,
@@ -381,7 +407,7 @@ public:
      * @return Returns a const iterator pointing
      * to the first element in the ring buffer.
      */
-    const_iterator begin() const
+    RINGBUFFER_CONSTEXPR const_iterator begin() const
     {
         return cbegin();
     }
@@ -391,7 +417,7 @@ public:
      * @return Returns a const iterator pointing
      * to the first element in the ring buffer.
      */
-    const_iterator cbegin() const
+    RINGBUFFER_CONSTEXPR const_iterator cbegin() const
     {
         return const_iterator(const_cast<T*>(m_buffer),
                               m_beginPosition,
@@ -403,7 +429,7 @@ public:
      * @return Returns an iterator pointing
      * to the end of the ring buffer.
      */
-    iterator end()
+    RINGBUFFER_CONSTEXPR iterator end()
     {
         if (Size == 0)
         {
@@ -411,7 +437,7 @@ public:
         }
 
         return iterator(m_buffer,
-                        m_insertPosition % Size,
+                        insert_position(),
                         m_length);
     }
 
@@ -420,7 +446,7 @@ public:
      * @return Returns a const iterator pointing
      * to the end of the ring buffer.
      */
-    const_iterator end() const
+    RINGBUFFER_CONSTEXPR const_iterator end() const
     {
         return cend();
     }
@@ -430,10 +456,10 @@ public:
      * @return Returns a const iterator pointing
      * to the end of the ring buffer.
      */
-    const_iterator cend() const
+    RINGBUFFER_CONSTEXPR const_iterator cend() const
     {
         return const_iterator(const_cast<T*>(m_buffer),
-                              m_insertPosition,
+                              insert_position(),
                               m_length);
     }
 
@@ -443,7 +469,7 @@ public:
      * @return Returns a reverse iterator that's pointing
      * to the end element.
      */
-    reverse_iterator rbegin()
+    RINGBUFFER_CONSTEXPR reverse_iterator rbegin()
     {
         return std::reverse_iterator<iterator>(end());
     }
@@ -454,7 +480,7 @@ public:
      * @return Returns a reverse iterator that's pointing
      * to the last element.
      */
-    const_reverse_iterator rbegin() const
+    RINGBUFFER_CONSTEXPR const_reverse_iterator rbegin() const
     {
         return crbegin();
     }
@@ -464,7 +490,7 @@ public:
      * @return Returns const reverse iterator that's pointing to
      * the last element.
      */
-    const_reverse_iterator crbegin() const
+    RINGBUFFER_CONSTEXPR const_reverse_iterator crbegin() const
     {
         return std::reverse_iterator<const_iterator>(end());
     }
@@ -474,7 +500,7 @@ public:
      * @return Returns reverse iterator that's pointing to
      * the first element.
      */
-    reverse_iterator rend()
+    RINGBUFFER_CONSTEXPR reverse_iterator rend()
     {
         return std::reverse_iterator<iterator>(begin());
     }
@@ -484,7 +510,7 @@ public:
      * @return Returns const reverse iterator that's pointing to
      * the first element.
      */
-    const_reverse_iterator rend() const
+    RINGBUFFER_CONSTEXPR const_reverse_iterator rend() const
     {
         return crend();
     }
@@ -494,7 +520,7 @@ public:
      * @return Returns const reverse iterator that's pointing to
      * the first element.
      */
-    const_reverse_iterator crend() const
+    RINGBUFFER_CONSTEXPR const_reverse_iterator crend() const
     {
         return std::reverse_iterator<iterator>(begin());
     }
@@ -503,7 +529,7 @@ public:
      * @brief Method for getting number of elements.
      * @return Number of elements.
      */
-    size_type size() const
+    RINGBUFFER_CONSTEXPR size_type size() const
     {
         return m_length;
     }
@@ -512,47 +538,47 @@ public:
      * @brief Return maximum size.
      * @return Returns the maximum number of elements that the vector can hold.
      */
-    size_type max_size() const
+    RINGBUFFER_CONSTEXPR size_type max_size() const
     {
         return Size;
     }
 
-    bool empty() const
+    RINGBUFFER_CONSTEXPR bool empty() const
     {
         return m_length == 0;
     }
 
-    reference front()
+    RINGBUFFER_CONSTEXPR reference front()
     {
         return m_buffer[m_beginPosition];
     }
 
-    const_reference front() const
+    RINGBUFFER_CONSTEXPR const_reference front() const
     {
         return m_buffer[m_beginPosition];
     }
 
-    reference back()
+    RINGBUFFER_CONSTEXPR reference back()
     {
-        return m_buffer[dec_index(m_insertPosition)];
+        return m_buffer[dec_index(insert_position())];
     }
 
-    const_reference back() const
+    RINGBUFFER_CONSTEXPR const_reference back() const
     {
-        return m_buffer[dec_index(m_insertPosition)];
+        return m_buffer[dec_index(insert_position())];
     }
 
-    reference operator[](size_type n)
+    RINGBUFFER_CONSTEXPR reference operator[](size_type n)
     {
         return m_buffer[inc_index(m_beginPosition, n)];
     }
 
-    const_reference operator[](size_type n) const
+    RINGBUFFER_CONSTEXPR const_reference operator[](size_type n) const
     {
         return m_buffer[inc_index(m_beginPosition, n)];
     }
 
-    reference at(size_type n)
+    RINGBUFFER_CONSTEXPR reference at(size_type n)
     {
         if (n >= m_length)
         {
@@ -562,7 +588,7 @@ public:
         return (*this)[n];
     }
 
-    const_reference at(size_type n) const
+    RINGBUFFER_CONSTEXPR const_reference at(size_type n) const
     {
         if (n >= m_length)
         {
@@ -572,55 +598,143 @@ public:
         return (*this)[n];
     }
 
+    /**
+     * @brief Method for getting storage slot of element.
+     * Slot doesn't change, while element is stored (unless
+     * elements are shifted by `insert`, `erase` or
+     * `remove_if`), so it may be used as key of side tables.
+     * @param n Element index in [0, size()]. `size()` gives
+     * slot of next pushed element.
+     * @return Slot in [0, Size) range.
+     */
+    RINGBUFFER_CONSTEXPR size_type slot_index(size_type n) const
+    {
+        auto slot = static_cast<size_type>(m_beginPosition) + n;
+
+        return slot >= Size ? slot - Size : slot;
+    }
+
+    /**
+     * @brief Method for getting index of element,
+     * stored in slot (inverse of `slot_index`).
+     * @param slot Slot in [0, Size) range.
+     * @return Element index.
+     */
+    RINGBUFFER_CONSTEXPR size_type element_index(size_type slot) const
+    {
+        return slot >= m_beginPosition ? slot - m_beginPosition : slot + Size - m_beginPosition;
+    }
+
     /**
      * @brief Method for pushing back element.
      * If not enough space left, elements will be overwritten.
      * @param value Value.
      */
-    void push_back(const value_type& value)
+    RINGBUFFER_CONSTEXPR void push_back(const value_type& value)
     {
-        m_buffer[m_insertPosition] = value;
+        m_buffer[insert_position()] = value;
 
-        m_insertPosition = inc_index(m_insertPosition);
+        publish_back();
+    }
+
+    /**
+     * @brief Method for getting slot of next pushed element,
+     * so it can be refilled in place. Storage objects are
+     * never destroyed, so slot holds element, that was popped
+     * (or will be overwritten) earlier, and its allocated
+     * capacity is reused. Element is published by `publish_back`.
+     * If ringbuffer is full, slot holds front element.
+     * @return Reference to slot.
+     */
+    RINGBUFFER_CONSTEXPR reference acquire_back()
+    {
+        return m_buffer[insert_position()];
+    }
 
+    /**
+     * @brief Method for publishing element, refilled
+     * in slot returned by `acquire_back`.
+     * If not enough space left, front element is overwritten.
+     */
+    RINGBUFFER_CONSTEXPR void publish_back()
+    {
         if (m_length < Size)
         {
             m_length++;
         }
+        else
+        {
+            // Oldest element was overwritten
+            m_beginPosition = static_cast<index_type>(inc_index(m_beginPosition));
+        }
+    }
+
+    /**
+     * @brief Method for pushing back element, refilled in
+     * place by function (see `acquire_back`). Once slots are
+     * warmed up, pushing variable sized buffers doesn't
+     * allocate.
+     * @tparam Function Callable with `void(reference)` signature.
+     * @param function Function.
+     */
+    template<typename Function>
+    RINGBUFFER_CONSTEXPR void refill_back(Function function)
+    {
+        function(acquire_back());
+
+        publish_back();
     }
 
     /**
      * @brief Method for popping element from back.
      */
-    void pop_back()
+    RINGBUFFER_CONSTEXPR void pop_back()
     {
         if (empty())
         {
             throw std::overflow_error("There is no elements.");
         }
 
-        m_insertPosition = dec_index(m_insertPosition);
-
         --m_length;
     }
 
     template<typename... Args>
-    void emplace_back(Args&&... args)
+    RINGBUFFER_CONSTEXPR void emplace_back(Args&&... args)
     {
-        m_buffer[m_insertPosition] = T(args...);
+        m_buffer[insert_position()] = T(args...);
 
-        m_insertPosition = inc_index(m_insertPosition);
+        publish_back();
+    }
 
-        if (m_length < Size)
-        {
-            m_length++;
-        }
+    /**
+     * @brief Method for pushing front element.
+     * If not enough space left, back element will be overwritten.
+     * @param value Value.
+     */
+    RINGBUFFER_CONSTEXPR void push_front(const value_type& value)
+    {
+        m_buffer[dec_index(m_beginPosition)] = value;
+
+        grow_front();
+    }
+
+    /**
+     * @brief Method for constructing element in front.
+     * If not enough space left, back element will be overwritten.
+     * @param args Constructor arguments.
+     */
+    template<typename... Args>
+    RINGBUFFER_CONSTEXPR void emplace_front(Args&&... args)
+    {
+        m_buffer[dec_index(m_beginPosition)] = T(std::forward<Args>(args)...);
+
+        grow_front();
     }
 
     /**
      * @brief Method for popping element from front.
      */
-    void pop_front()
+    RINGBUFFER_CONSTEXPR void pop_front()
     {
         if (empty())
         {
@@ -629,77 +743,522 @@ public:
 
 //        m_allocator.destroy(&m_buffer[m_beginPosition]);
 
-        m_beginPosition = inc_index(m_beginPosition);
+        m_beginPosition = static_cast<index_type>(inc_index(m_beginPosition));
         --m_length;
     }
 
+    /**
+     * @brief Method for popping front element by swapping it
+     * with value. Previous object of value is returned to
+     * storage, so its allocation is reused by later refills.
+     * @param value Value, that receives front element.
+     */
+    RINGBUFFER_CONSTEXPR void take_front(value_type& value)
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        using std::swap;
+
+        swap(value, m_buffer[m_beginPosition]);
+
+        pop_front();
+    }
+
     /**
      * @brief Method for popping several elements from front.
      */
-    void pop_front(size_type count)
+    RINGBUFFER_CONSTEXPR void pop_front(size_type count)
     {
         if (m_length < count)
         {
             throw std::overflow_error("Not enough elements.");
         }
 
-        m_beginPosition = inc_index(m_beginPosition, count);
-        m_length -= count;
+        m_beginPosition = static_cast<index_type>(inc_index(m_beginPosition, count));
+        m_length = static_cast<index_type>(m_length - count);
+    }
+
+    /**
+     * @brief Method for getting first part of
+     * stored elements, that starts with front element.
+     * @return Segment, that's empty if ringbuffer is empty.
+     */
+    RINGBUFFER_CONSTEXPR segment first_segment()
+    {
+        return {m_buffer + m_beginPosition, first_length()};
+    }
+
+    /**
+     * @brief Method for getting first part of
+     * stored elements, that starts with front element.
+     * @return Segment, that's empty if ringbuffer is empty.
+     */
+    RINGBUFFER_CONSTEXPR const_segment first_segment() const
+    {
+        return {m_buffer + m_beginPosition, first_length()};
+    }
+
+    /**
+     * @brief Method for getting second part of stored
+     * elements, that starts at beginning of storage.
+     * @return Segment, that's empty if elements don't wrap.
+     */
+    RINGBUFFER_CONSTEXPR segment second_segment()
+    {
+        return {m_buffer, m_length - first_length()};
+    }
+
+    /**
+     * @brief Method for getting second part of stored
+     * elements, that starts at beginning of storage.
+     * @return Segment, that's empty if elements don't wrap.
+     */
+    RINGBUFFER_CONSTEXPR const_segment second_segment() const
+    {
+        return {m_buffer, m_length - first_length()};
+    }
+
+    /**
+     * @brief Method for getting first part of free
+     * space, that starts right after back element.
+     * Written elements are published with `commit`.
+     * @return Segment, that's empty if ringbuffer is full.
+     */
+    RINGBUFFER_CONSTEXPR segment first_free_segment()
+    {
+        return {m_buffer + insert_position(), first_free_length()};
+    }
+
+    /**
+     * @brief Method for getting second part of free
+     * space, that starts at beginning of storage.
+     * @return Segment, that's empty if free space doesn't wrap.
+     */
+    RINGBUFFER_CONSTEXPR segment second_free_segment()
+    {
+        return {m_buffer, (Size - m_length) - first_free_length()};
+    }
+
+    /**
+     * @brief Method for getting view of all elements.
+     */
+    ringbuffer_span<value_type> view()
+    {
+        return {m_buffer + m_beginPosition, first_length(), m_buffer, m_length - first_length()};
+    }
+
+    ringbuffer_span<const value_type> view() const
+    {
+        return {m_buffer + m_beginPosition, first_length(), m_buffer, m_length - first_length()};
+    }
+
+    /**
+     * @brief Method for getting view of last elements.
+     * @param count Number of elements. If there are less
+     * elements, all of them are viewed.
+     */
+    ringbuffer_span<value_type> tail(size_type count)
+    {
+        count = std::min<size_type>(count, m_length);
+
+        return view().subspan(m_length - count, count);
+    }
+
+    ringbuffer_span<const value_type> tail(size_type count) const
+    {
+        count = std::min<size_type>(count, m_length);
+
+        return view().subspan(m_length - count, count);
+    }
+
+    /**
+     * @brief Method for getting view of elements
+     * in [offset, offset + count) range.
+     * @param offset Index of first element.
+     * @param count Number of elements.
+     */
+    ringbuffer_span<value_type> window(size_type offset, size_type count)
+    {
+        return view().subspan(offset, count);
+    }
+
+    ringbuffer_span<const value_type> window(size_type offset, size_type count) const
+    {
+        return view().subspan(offset, count);
+    }
+
+    /**
+     * @brief Method for getting view of every n-th element,
+     * starting from front.
+     * @param step Distance between viewed elements.
+     */
+    ringbuffer_stride_view<value_type> stride(size_type step)
+    {
+        return {view(), step};
+    }
+
+    ringbuffer_stride_view<const value_type> stride(size_type step) const
+    {
+        return {view(), step};
+    }
+
+    /**
+     * @brief Method for getting view of elements split
+     * into chunks of fixed size.
+     * @param count Number of elements in chunk.
+     */
+    ringbuffer_chunk_view<value_type> chunks(size_type count)
+    {
+        return {view(), count};
+    }
+
+    ringbuffer_chunk_view<const value_type> chunks(size_type count) const
+    {
+        return {view(), count};
+    }
+
+    /**
+     * @brief Method for reserving free slots, so elements
+     * can be constructed in place and published later
+     * with `commit`.
+     * @param count Number of slots.
+     * @return View of at most `count` free slots (less, if
+     * there is not enough free space).
+     */
+    ringbuffer_span<value_type> reserve(size_type count)
+    {
+        auto first = first_free_segment();
+        auto second = second_free_segment();
+
+        return ringbuffer_span<value_type>(first.data, first.size, second.data, second.size)
+            .subspan(0, std::min(count, first.size + second.size));
+    }
+
+    /**
+     * @brief Method for publishing elements, that
+     * were written into free segments.
+     * @param count Number of written elements.
+     */
+    RINGBUFFER_CONSTEXPR void commit(size_type count)
+    {
+        if (Size - m_length < count)
+        {
+            throw std::overflow_error("Not enough free space.");
+        }
+
+        m_length = static_cast<index_type>(m_length + count);
     }
 
     /**
      * @brief Method for clearing
      * container.
      */
-    void clear()
+    RINGBUFFER_CONSTEXPR void clear()
     {
         // Destroying objects
 
         m_beginPosition = 0;
-        m_insertPosition = 0;
         m_length = 0;
     }
 
+    /**
+     * @brief Method for inserting element before position.
+     * @param position Iterator to element.
+     * @param value Value.
+     * @return Iterator to inserted element.
+     */
+    iterator insert(const_iterator position, const value_type& value)
+    {
+        // Value may refer to element of this ringbuffer,
+        // that is moved, while gap is made
+        value_type copy(value);
+
+        return insert(position, std::make_move_iterator(&copy), std::make_move_iterator(&copy + 1));
+    }
+
+    /**
+     * @brief Method for inserting range of elements before
+     * position. Shorter side of ringbuffer (elements before
+     * or after position) is shifted to make a gap, so it
+     * takes O(min(before, after)) moves. Range must not
+     * refer to elements of this ringbuffer, because they
+     * are moved before range is read.
+     * @tparam ForwardIterator Iterator type.
+     * @param position Iterator to element.
+     * @param first Begin iterator.
+     * @param last End iterator.
+     * @return Iterator to first inserted element.
+     */
+    template<typename ForwardIterator>
+    iterator insert(const_iterator position, ForwardIterator first, ForwardIterator last)
+    {
+        auto index = position.m_traverseCount;
+        auto count = static_cast<size_type>(std::distance(first, last));
+
+        if (index > m_length)
+        {
+            throw std::out_of_range("Index is out of range.");
+        }
+
+        if (Size - m_length < count)
+        {
+            throw std::overflow_error("Not enough free space.");
+        }
+
+        if (count == 0)
+        {
+            return begin() + index;
+        }
+
+        if (index < m_length - index)
+        {
+            auto begin = dec_index(m_beginPosition, count);
+
+            move_elements(m_beginPosition, begin, index);
+
+            m_beginPosition = static_cast<index_type>(begin);
+        }
+        else
+        {
+            move_elements_backward(inc_index(m_beginPosition, index),
+                                   inc_index(m_beginPosition, index + count),
+                                   m_length - index);
+        }
+
+        m_length = static_cast<index_type>(m_length + count);
+
+        for (auto target = inc_index(m_beginPosition, index); first != last; ++first)
+        {
+            m_buffer[target] = *first;
+            target = inc_index(target);
+        }
+
+        return begin() + index;
+    }
+
+    /**
+     * @brief Method for erasing element.
+     * @param position Iterator to element.
+     * @return Iterator to element, that followed erased one.
+     */
     iterator erase(const_iterator position)
     {
-        if (position.m_currentPos == 0)
+        return erase(position, position + 1);
+    }
+
+    /**
+     * @brief Method for erasing range of elements.
+     * Shorter side of ringbuffer (elements before or
+     * after the range) is shifted to close the gap, so
+     * it takes O(min(before, after)) moves.
+     * @param first Iterator to first erased element.
+     * @param last Iterator after last erased element.
+     * @return Iterator to element, that followed erased ones.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto from = first.m_traverseCount;
+        auto to = last.m_traverseCount;
+
+        if (from > to || to > m_length)
         {
-            pop_front();
-            return begin();
+            throw std::out_of_range("Index is out of range.");
         }
 
-        if (position.m_currentPos % m_length == m_length - 1)
+        auto count = to - from;
+
+        if (count == 0)
         {
-            pop_back();
-            return end();
+            return begin() + from;
         }
 
-        // Erasing from middle
-        m_buffer[position.m_currentPos] = value_type();
+        if (from < m_length - to)
+        {
+            move_elements_backward(m_beginPosition,
+                                   inc_index(m_beginPosition, count),
+                                   from);
 
-        for (auto iterator = position,
-                 nextIterator = position + 1,
-                 endIterator = end();
-             nextIterator != endIterator;
-             ++iterator, ++nextIterator)
+            m_beginPosition = static_cast<index_type>(inc_index(m_beginPosition, count));
+        }
+        else
         {
-            m_buffer[iterator.m_currentPos] = m_buffer[nextIterator.m_currentPos];
+            move_elements(inc_index(m_beginPosition, to),
+                          inc_index(m_beginPosition, from),
+                          m_length - to);
         }
 
-        --m_length;
-        m_insertPosition = dec_index(m_insertPosition);
+        m_length = static_cast<index_type>(m_length - count);
 
-        return begin() + position.m_traverseCount;
+        return begin() + from;
+    }
+
+    /**
+     * @brief Method for erasing all elements, that satisfy
+     * predicate. Survivors keep their order and are compacted
+     * in single pass.
+     * @tparam Predicate Callable with `bool(const_reference)` signature.
+     * @param predicate Predicate.
+     * @return Number of erased elements.
+     */
+    template<typename Predicate>
+    size_type remove_if(Predicate predicate)
+    {
+        size_type source = m_beginPosition;
+        size_type target = m_beginPosition;
+        size_type kept = 0;
+
+        for (size_type i = 0; i < m_length; ++i)
+        {
+            if (!predicate(static_cast<const_reference>(m_buffer[source])))
+            {
+                if (target != source)
+                {
+                    m_buffer[target] = std::move(m_buffer[source]);
+                }
+
+                target = inc_index(target);
+                ++kept;
+            }
+
+            source = inc_index(source);
+        }
+
+        auto removed = m_length - kept;
+
+        m_length = static_cast<index_type>(kept);
+
+        return removed;
     }
 
 private:
 
-    size_type inc_index(const size_type& index, const size_type& n = 1) const
+    /**
+     * @brief Smallest unsigned type, that can hold
+     * values in [0, Size] range.
+     */
+    using index_type = typename std::conditional<
+        Size <= std::numeric_limits<std::uint8_t>::max(),
+        std::uint8_t,
+        typename std::conditional<
+            Size <= std::numeric_limits<std::uint16_t>::max(),
+            std::uint16_t,
+            typename std::conditional<
+                Size <= std::numeric_limits<std::uint32_t>::max(),
+                std::uint32_t,
+                std::size_t
+            >::type
+        >::type
+    >::type;
+
+    /**
+     * @brief Position, where next element will be pushed.
+     * It's not stored, because it's defined by begin
+     * position and length.
+     */
+    RINGBUFFER_CONSTEXPR size_type insert_position() const
+    {
+        // Both are in [0, Size] range, so sum is less than 2 * Size
+        auto position = static_cast<size_type>(m_beginPosition) + m_length;
+
+        return position >= Size ? position - Size : position;
+    }
+
+    RINGBUFFER_CONSTEXPR size_type first_length() const
+    {
+        return std::min<size_type>(m_length, Size - m_beginPosition);
+    }
+
+    RINGBUFFER_CONSTEXPR size_type first_free_length() const
+    {
+        return std::min<size_type>(Size - m_length, Size - insert_position());
+    }
+
+    RINGBUFFER_CONSTEXPR void grow_front()
+    {
+        m_beginPosition = static_cast<index_type>(dec_index(m_beginPosition));
+
+        if (m_length < Size)
+        {
+            m_length++;
+        }
+    }
+
+    /**
+     * @brief Method for moving elements to lower logical
+     * positions (target is before source). Physical ranges
+     * are split at storage end, trivially copyable elements
+     * are moved with memmove.
+     * @param source Physical position of first source element.
+     * @param target Physical position of first target element.
+     * @param count Number of elements.
+     */
+    void move_elements(size_type source, size_type target, size_type count)
+    {
+        while (count != 0)
+        {
+            auto chunk = std::min(count, std::min(Size - source, Size - target));
+
+            move_chunk(source, target, chunk, std::is_trivially_copyable<value_type>());
+
+            source = inc_index(source, chunk);
+            target = inc_index(target, chunk);
+            count -= chunk;
+        }
+    }
+
+    /**
+     * @brief Method for moving elements to higher logical
+     * positions (target is after source). Elements are
+     * moved starting from the last one.
+     * @param source Physical position of first source element.
+     * @param target Physical position of first target element.
+     * @param count Number of elements.
+     */
+    void move_elements_backward(size_type source, size_type target, size_type count)
+    {
+        auto sourceEnd = inc_index(source, count);
+        auto targetEnd = inc_index(target, count);
+
+        while (count != 0)
+        {
+            auto chunk = std::min(count, std::min(sourceEnd == 0 ? Size : sourceEnd,
+                                                  targetEnd == 0 ? Size : targetEnd));
+
+            sourceEnd = dec_index(sourceEnd, chunk);
+            targetEnd = dec_index(targetEnd, chunk);
+
+            move_chunk(sourceEnd, targetEnd, chunk, std::is_trivially_copyable<value_type>());
+
+            count -= chunk;
+        }
+    }
+
+    void move_chunk(size_type source, size_type target, size_type count, std::true_type)
+    {
+        std::memmove(m_buffer + target, m_buffer + source, count * sizeof(value_type));
+    }
+
+    void move_chunk(size_type source, size_type target, size_type count, std::false_type)
+    {
+        if (target < source)
+        {
+            std::move(m_buffer + source, m_buffer + source + count, m_buffer + target);
+        }
+        else
+        {
+            std::move_backward(m_buffer + source, m_buffer + source + count, m_buffer + target + count);
+        }
+    }
+
+    RINGBUFFER_CONSTEXPR size_type inc_index(const size_type& index, const size_type& n = 1) const
     {
         return (index + n) % Size;
     }
 
-    size_type dec_index(const size_type& index, const size_type& n = 1) const
+    RINGBUFFER_CONSTEXPR size_type dec_index(const size_type& index, const size_type& n = 1) const
     {
         if (n > index)
         {
@@ -712,8 +1271,19 @@ private:
     }
 
     value_type m_buffer[Size];
-    size_type m_length;
-    size_type m_insertPosition;
-    size_type m_beginPosition;
+    index_type m_length;
+    index_type m_beginPosition;
 };
 
+/**
+ * @brief Function for erasing all elements of ringbuffer,
+ * that satisfy predicate (same as `std::erase_if`).
+ * @param buffer Ringbuffer.
+ * @param predicate Predicate.
+ * @return Number of erased elements.
+ */
+template<typename T, std::size_t Size, typename Predicate>
+typename ringbuffer<T, Size>::size_type erase_if(ringbuffer<T, Size>& buffer, Predicate predicate)
+{
+    return buffer.remove_if(predicate);
+}
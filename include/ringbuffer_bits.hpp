@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ringbuffer_detail
+{
+    /**
+     * @brief Number of bits required to store value.
+     * @param value Value.
+     * @return Returns 0 for 0, otherwise index of highest set bit + 1.
+     */
+    inline unsigned bit_width(std::uint64_t value)
+    {
+        if (value == 0)
+        {
+            return 0;
+        }
+
+#if defined(__GNUC__) || defined(__clang__)
+        return 64u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+        unsigned result = 0;
+
+        while (value != 0)
+        {
+            value >>= 1;
+            ++result;
+        }
+
+        return result;
+#endif
+    }
+
+    /**
+     * @brief Smallest power of two exponent, that covers value.
+     * @param value Value.
+     * @return Smallest `n`, for which `2^n >= value`.
+     */
+    constexpr std::size_t ceil_log2(std::size_t value, std::size_t result = 0)
+    {
+        return (std::size_t(1) << result) >= value ? result : ceil_log2(value, result + 1);
+    }
+
+    /**
+     * @brief Index of lowest set bit.
+     * @param value Value. Must not be 0.
+     */
+    inline unsigned count_trailing_zeros(std::uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(value));
+#else
+        unsigned result = 0;
+
+        while ((value & 1) == 0)
+        {
+            value >>= 1;
+            ++result;
+        }
+
+        return result;
+#endif
+    }
+}
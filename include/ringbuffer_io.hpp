@@ -0,0 +1,88 @@
+#pragma once
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Function for writing stored bytes to file
+ * descriptor without intermediate copy. Occupied segments
+ * are passed to single `writev` call, written bytes are
+ * popped from front. Partial writes pop only written part.
+ * @tparam T Byte type.
+ * @tparam Size Ringbuffer size.
+ * @param fd File descriptor.
+ * @param buffer Ringbuffer.
+ * @return Number of written bytes, or -1 on error
+ * (`errno` is set by `writev`). Returns 0 if
+ * ringbuffer is empty.
+ */
+template<typename T, std::size_t Size>
+ssize_t ringbuffer_write_to(int fd, ringbuffer<T, Size>& buffer)
+{
+    static_assert(sizeof(T) == 1, "Only byte ringbuffers can be written to file descriptor.");
+
+    if (buffer.empty())
+    {
+        return 0;
+    }
+
+    auto first = buffer.first_segment();
+    auto second = buffer.second_segment();
+
+    iovec vectors[2] = {
+        {first.data, first.size},
+        {second.data, second.size}
+    };
+
+    auto result = writev(fd, vectors, second.size == 0 ? 1 : 2);
+
+    if (result > 0)
+    {
+        buffer.pop_front(static_cast<std::size_t>(result));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Function for reading bytes from file descriptor
+ * directly into ringbuffer free space. Free segments are
+ * passed to single `readv` call, read bytes are published
+ * at back. Partial reads publish only read part.
+ * @tparam T Byte type.
+ * @tparam Size Ringbuffer size.
+ * @param fd File descriptor.
+ * @param buffer Ringbuffer.
+ * @return Number of read bytes, 0 on end of file, or -1
+ * on error (`errno` is set by `readv`). Returns 0 without
+ * reading if ringbuffer is full.
+ */
+template<typename T, std::size_t Size>
+ssize_t ringbuffer_read_from(int fd, ringbuffer<T, Size>& buffer)
+{
+    static_assert(sizeof(T) == 1, "Only byte ringbuffers can be read from file descriptor.");
+
+    if (buffer.size() == buffer.max_size())
+    {
+        return 0;
+    }
+
+    auto first = buffer.first_free_segment();
+    auto second = buffer.second_free_segment();
+
+    iovec vectors[2] = {
+        {first.data, first.size},
+        {second.data, second.size}
+    };
+
+    auto result = readv(fd, vectors, second.size == 0 ? 1 : 2);
+
+    if (result > 0)
+    {
+        buffer.commit(static_cast<std::size_t>(result));
+    }
+
+    return result;
+}
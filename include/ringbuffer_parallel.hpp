@@ -0,0 +1,526 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Standard execution policies are opt-in, because including
+// <execution> makes libstdc++ depend on TBB
+#if defined(RINGBUFFER_USE_EXECUTION)
+#include <execution>
+#endif
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Class, that describes small fixed thread pool
+ * for parallel traversal of ringbuffers. Calling thread
+ * takes part in every run, so pool with `n` threads
+ * starts `n - 1` workers. Runs are serialized. Runs,
+ * started from inside of task (of any pool), are executed
+ * inline by calling thread, because waiting for busy
+ * workers would deadlock.
+ */
+class ringbuffer_parallel_pool
+{
+public:
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructor.
+     * @param threadCount Number of threads, including
+     * calling one. Zero means hardware concurrency.
+     */
+    explicit ringbuffer_parallel_pool(size_type threadCount = 0) :
+        m_threadCount(threadCount != 0 ? threadCount : std::max<size_type>(1, std::thread::hardware_concurrency())),
+        m_workers(),
+        m_runMutex(),
+        m_mutex(),
+        m_started(),
+        m_finished(),
+        m_generation(0),
+        m_stopping(false),
+        m_task(nullptr),
+        m_taskData(nullptr),
+        m_taskCount(0),
+        m_next(0),
+        m_active(0)
+    {
+        m_workers.reserve(m_threadCount - 1);
+
+        for (size_type i = 1; i < m_threadCount; ++i)
+        {
+            m_workers.emplace_back(&ringbuffer_parallel_pool::work, this);
+        }
+    }
+
+    ringbuffer_parallel_pool(const ringbuffer_parallel_pool&) = delete;
+
+    ringbuffer_parallel_pool& operator=(const ringbuffer_parallel_pool&) = delete;
+
+    ~ringbuffer_parallel_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_stopping = true;
+        }
+
+        m_started.notify_all();
+
+        for (auto&& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Method for getting pool, shared by calls
+     * without explicit pool. It uses hardware concurrency.
+     */
+    static ringbuffer_parallel_pool& shared()
+    {
+        static ringbuffer_parallel_pool pool;
+
+        return pool;
+    }
+
+    size_type thread_count() const
+    {
+        return m_threadCount;
+    }
+
+    /**
+     * @brief Method for calling function for every
+     * index in [0, count). Returns, when all calls
+     * are finished. Function must not throw.
+     * @tparam Function Callable with `void(size_type)` signature.
+     * @param count Number of indices.
+     * @param function Function.
+     */
+    template<typename Function>
+    void run(size_type count, Function function)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (m_workers.empty() || count == 1 || inside_task())
+        {
+            for (size_type i = 0; i < count; ++i)
+            {
+                function(i);
+            }
+
+            return;
+        }
+
+        std::lock_guard<std::mutex> runLock(m_runMutex);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_task = &call<Function>;
+            m_taskData = &function;
+            m_taskCount = count;
+            m_next.store(0, std::memory_order_relaxed);
+            m_active = m_workers.size();
+            ++m_generation;
+        }
+
+        m_started.notify_all();
+
+        process();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_finished.wait(lock, [this]() { return m_active == 0; });
+    }
+
+private:
+
+    template<typename Function>
+    static void call(void* data, size_type index)
+    {
+        (*static_cast<Function*>(data))(index);
+    }
+
+    /**
+     * @brief Method for getting flag, that is set while
+     * current thread executes pool task.
+     */
+    static bool& inside_task()
+    {
+        static thread_local bool result = false;
+
+        return result;
+    }
+
+    void process()
+    {
+        size_type index;
+
+        inside_task() = true;
+
+        while ((index = m_next.fetch_add(1, std::memory_order_relaxed)) < m_taskCount)
+        {
+            m_task(m_taskData, index);
+        }
+
+        inside_task() = false;
+    }
+
+    void work()
+    {
+        std::uint64_t generation = 0;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true)
+        {
+            m_started.wait(lock, [this, generation]() { return m_generation != generation || m_stopping; });
+
+            if (m_stopping)
+            {
+                return;
+            }
+
+            generation = m_generation;
+
+            lock.unlock();
+
+            process();
+
+            lock.lock();
+
+            if (--m_active == 0)
+            {
+                m_finished.notify_one();
+            }
+        }
+    }
+
+    const size_type m_threadCount;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_runMutex;
+    std::mutex m_mutex;
+    std::condition_variable m_started;
+    std::condition_variable m_finished;
+
+    std::uint64_t m_generation;
+    bool m_stopping;
+
+    void (*m_task)(void*, size_type);
+    void* m_taskData;
+    size_type m_taskCount;
+    std::atomic<size_type> m_next;
+    size_type m_active;
+};
+
+namespace ringbuffer_detail
+{
+    constexpr std::size_t cache_line_size = 64;
+
+    /**
+     * @brief Function for getting storage slot of first
+     * element of span. It's known only for wrapped spans
+     * (second segment starts at slot 0), otherwise 0
+     * is returned.
+     */
+    template<typename T>
+    std::size_t span_first_slot(const ringbuffer_span<T>& span)
+    {
+        auto second = span.second_segment();
+
+        return second.size != 0 ? static_cast<std::size_t>(span.first_segment().data - second.data) : 0;
+    }
+
+    /**
+     * @brief Function for splitting span into chunks of
+     * about `grain` elements. Grain is rounded up to whole
+     * cache lines of elements, and inner boundaries are
+     * placed on storage slots, that are multiples of cache
+     * line elements, so neighbour chunks don't share lines
+     * (storage of ringbuffer starts on cache line, if it's
+     * allocated so). Chunk, that contains wrap point, spans
+     * both segments. Boundaries depend only on span size,
+     * its first slot and grain (not on storage address or
+     * number of threads), so reductions over chunks give
+     * same results for same ringbuffer state.
+     * @param span Elements.
+     * @param grain Number of elements in chunk.
+     * @param firstSlot Storage slot of first element of span.
+     */
+    template<typename T>
+    std::vector<ringbuffer_span<T>> parallel_chunks(const ringbuffer_span<T>& span,
+                                                    std::size_t grain,
+                                                    std::size_t firstSlot)
+    {
+        auto lineElements = cache_line_size % sizeof(T) == 0 ? cache_line_size / sizeof(T) : 1;
+
+        grain = std::max(grain, lineElements);
+        grain = (grain + lineElements - 1) / lineElements * lineElements;
+
+        auto firstSize = span.first_segment().size;
+
+        std::vector<std::size_t> bounds;
+        bounds.push_back(0);
+
+        // First chunk also takes unaligned head
+        auto head = (lineElements - firstSlot % lineElements) % lineElements;
+
+        for (auto bound = head + grain; bound < firstSize; bound += grain)
+        {
+            bounds.push_back(bound);
+        }
+
+        // Second segment starts at slot 0
+        for (auto bound = firstSize + grain; bound < span.size(); bound += grain)
+        {
+            bounds.push_back(bound);
+        }
+
+        bounds.push_back(span.size());
+
+        std::vector<ringbuffer_span<T>> result;
+        result.reserve(bounds.size() - 1);
+
+        for (std::size_t i = 1; i < bounds.size(); ++i)
+        {
+            if (bounds[i] > bounds[i - 1])
+            {
+                result.push_back(span.subspan(bounds[i - 1], bounds[i] - bounds[i - 1]));
+            }
+        }
+
+        return result;
+    }
+
+    template<typename T>
+    std::vector<ringbuffer_span<T>> parallel_chunks(const ringbuffer_span<T>& span, std::size_t grain)
+    {
+        return parallel_chunks(span, grain, span_first_slot(span));
+    }
+
+    template<typename T, typename Function>
+    void for_each_chunks(const std::vector<ringbuffer_span<T>>& chunks,
+                         Function& function,
+                         ringbuffer_parallel_pool& pool)
+    {
+        pool.run(chunks.size(), [&chunks, &function](std::size_t index)
+        {
+            chunks[index].for_each(function);
+        });
+    }
+
+    template<typename T, typename Result, typename Reduce>
+    Result reduce_chunk(const ringbuffer_span<T>& chunk, const Result& identity, Reduce& reduce)
+    {
+        Result result = identity;
+
+        chunk.for_each([&result, &reduce](typename ringbuffer_span<T>::reference el)
+        {
+            result = reduce(std::move(result), el);
+        });
+
+        return result;
+    }
+
+    template<typename Result, typename Combine>
+    Result combine_partials(std::vector<Result>& partials, const Result& identity, Combine& combine)
+    {
+        Result result = identity;
+
+        // Fixed left to right order keeps result deterministic
+        for (auto&& partial : partials)
+        {
+            result = combine(std::move(result), std::move(partial));
+        }
+
+        return result;
+    }
+
+    template<typename T, typename Result, typename Reduce, typename Combine>
+    Result reduce_chunks(const std::vector<ringbuffer_span<T>>& chunks,
+                         const Result& identity,
+                         Reduce& reduce,
+                         Combine& combine,
+                         ringbuffer_parallel_pool& pool)
+    {
+        std::vector<Result> partials(chunks.size(), identity);
+
+        pool.run(chunks.size(), [&chunks, &partials, &identity, &reduce](std::size_t index)
+        {
+            partials[index] = reduce_chunk(chunks[index], identity, reduce);
+        });
+
+        return combine_partials(partials, identity, combine);
+    }
+}
+
+/**
+ * @brief Default number of elements in chunk of
+ * parallel traversal.
+ */
+constexpr std::size_t ringbuffer_parallel_grain = 1 << 14;
+
+/**
+ * @brief Function for calling function for every element
+ * of span in parallel. Span is split into chunks (see
+ * `parallel_chunks`), that are processed by pool threads.
+ * @tparam T Element type.
+ * @tparam Function Callable with `void(T&)` signature. It's
+ * called concurrently for different elements.
+ * @param span Elements.
+ * @param function Function.
+ * @param pool Thread pool.
+ * @param grain Number of elements in chunk.
+ */
+template<typename T, typename Function>
+void parallel_for_each(const ringbuffer_span<T>& span,
+                       Function function,
+                       ringbuffer_parallel_pool& pool = ringbuffer_parallel_pool::shared(),
+                       std::size_t grain = ringbuffer_parallel_grain)
+{
+    ringbuffer_detail::for_each_chunks(ringbuffer_detail::parallel_chunks(span, grain), function, pool);
+}
+
+template<typename T, std::size_t Size, typename Function>
+void parallel_for_each(ringbuffer<T, Size>& buffer,
+                       Function function,
+                       ringbuffer_parallel_pool& pool = ringbuffer_parallel_pool::shared(),
+                       std::size_t grain = ringbuffer_parallel_grain)
+{
+    ringbuffer_detail::for_each_chunks(ringbuffer_detail::parallel_chunks(buffer.view(), grain, buffer.slot_index(0)),
+                                       function,
+                                       pool);
+}
+
+template<typename T, std::size_t Size, typename Function>
+void parallel_for_each(const ringbuffer<T, Size>& buffer,
+                       Function function,
+                       ringbuffer_parallel_pool& pool = ringbuffer_parallel_pool::shared(),
+                       std::size_t grain = ringbuffer_parallel_grain)
+{
+    ringbuffer_detail::for_each_chunks(ringbuffer_detail::parallel_chunks(buffer.view(), grain, buffer.slot_index(0)),
+                                       function,
+                                       pool);
+}
+
+/**
+ * @brief Function for reducing span in parallel. Every
+ * chunk is folded with `reduce` starting from `identity`,
+ * then chunk results are merged with `combine` in chunk
+ * order. Chunks depend only on ringbuffer state and grain,
+ * so result is same for any number of threads and any
+ * placement of storage (floating point sums included).
+ * @tparam T Element type.
+ * @tparam Result Result type.
+ * @tparam Reduce Callable with `Result(Result, T&)` signature.
+ * @tparam Combine Callable with `Result(Result, Result)` signature.
+ * @param span Elements.
+ * @param identity Neutral value of `combine`.
+ * @param reduce Function for adding element to result.
+ * @param combine Function for merging results.
+ * @param pool Thread pool.
+ * @param grain Number of elements in chunk.
+ * @return Result.
+ */
+template<typename T, typename Result, typename Reduce, typename Combine>
+Result parallel_reduce(const ringbuffer_span<T>& span,
+                       Result identity,
+                       Reduce reduce,
+                       Combine combine,
+                       ringbuffer_parallel_pool& pool = ringbuffer_parallel_pool::shared(),
+                       std::size_t grain = ringbuffer_parallel_grain)
+{
+    return ringbuffer_detail::reduce_chunks(ringbuffer_detail::parallel_chunks(span, grain),
+                                            identity,
+                                            reduce,
+                                            combine,
+                                            pool);
+}
+
+template<typename T, std::size_t Size, typename Result, typename Reduce, typename Combine>
+Result parallel_reduce(const ringbuffer<T, Size>& buffer,
+                       Result identity,
+                       Reduce reduce,
+                       Combine combine,
+                       ringbuffer_parallel_pool& pool = ringbuffer_parallel_pool::shared(),
+                       std::size_t grain = ringbuffer_parallel_grain)
+{
+    return ringbuffer_detail::reduce_chunks(ringbuffer_detail::parallel_chunks(buffer.view(), grain, buffer.slot_index(0)),
+                                            identity,
+                                            reduce,
+                                            combine,
+                                            pool);
+}
+
+#if defined(RINGBUFFER_USE_EXECUTION)
+/**
+ * @brief Function for calling function for every element
+ * of span with standard execution policy. Chunks are same
+ * as with thread pool. Enabled by `RINGBUFFER_USE_EXECUTION`.
+ * @param policy Execution policy.
+ * @param span Elements.
+ * @param function Function.
+ * @param grain Number of elements in chunk.
+ */
+template<typename Policy, typename T, typename Function,
+         typename = typename std::enable_if<std::is_execution_policy<typename std::decay<Policy>::type>::value>::type>
+void parallel_for_each(Policy&& policy,
+                       const ringbuffer_span<T>& span,
+                       Function function,
+                       std::size_t grain = ringbuffer_parallel_grain)
+{
+    auto chunks = ringbuffer_detail::parallel_chunks(span, grain);
+
+    std::for_each(std::forward<Policy>(policy), chunks.begin(), chunks.end(), [&function](const ringbuffer_span<T>& chunk)
+    {
+        chunk.for_each(function);
+    });
+}
+
+/**
+ * @brief Function for reducing span with standard execution
+ * policy. Combination order is same as with thread pool.
+ * @param policy Execution policy.
+ * @param span Elements.
+ * @param identity Neutral value of `combine`.
+ * @param reduce Function for adding element to result.
+ * @param combine Function for merging results.
+ * @param grain Number of elements in chunk.
+ * @return Result.
+ */
+template<typename Policy, typename T, typename Result, typename Reduce, typename Combine,
+         typename = typename std::enable_if<std::is_execution_policy<typename std::decay<Policy>::type>::value>::type>
+Result parallel_reduce(Policy&& policy,
+                       const ringbuffer_span<T>& span,
+                       Result identity,
+                       Reduce reduce,
+                       Combine combine,
+                       std::size_t grain = ringbuffer_parallel_grain)
+{
+    auto chunks = ringbuffer_detail::parallel_chunks(span, grain);
+
+    std::vector<Result> partials(chunks.size(), identity);
+
+    std::transform(std::forward<Policy>(policy), chunks.begin(), chunks.end(), partials.begin(),
+                   [&identity, &reduce](const ringbuffer_span<T>& chunk)
+    {
+        return ringbuffer_detail::reduce_chunk(chunk, identity, reduce);
+    });
+
+    return ringbuffer_detail::combine_partials(partials, identity, combine);
+}
+#endif
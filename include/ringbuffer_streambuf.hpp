@@ -0,0 +1,137 @@
+#pragma once
+
+#include <streambuf>
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Class, that describes stream buffer over byte
+ * ringbuffer. First free segment of ringbuffer is used as
+ * put area and first occupied segment is used as get area,
+ * so `std::ostream` formats directly into ringbuffer storage
+ * and `std::istream` parses directly from it.
+ * Written characters are published on `pubsync`, on
+ * switching to next segment and before reading. Read
+ * characters are popped on the same points. If ringbuffer
+ * is full, writing fails (stream gets `badbit`) instead of
+ * overwriting unread data.
+ * Ringbuffer must not be modified directly while stream
+ * buffer has unpublished data, call `pubsync` first.
+ * @tparam Size Ringbuffer size.
+ */
+template<std::size_t Size>
+class ringbuf_streambuf : public std::streambuf
+{
+public:
+
+    using buffer_type = ringbuffer<char, Size>;
+
+    /**
+     * @brief Constructor.
+     * @param buffer Ringbuffer, that must outlive stream buffer.
+     */
+    explicit ringbuf_streambuf(buffer_type& buffer) :
+        m_buffer(buffer)
+    {
+        reset_areas();
+    }
+
+    ringbuf_streambuf(const ringbuf_streambuf&) = delete;
+
+    ringbuf_streambuf& operator=(const ringbuf_streambuf&) = delete;
+
+    ~ringbuf_streambuf()
+    {
+        synchronize();
+    }
+
+    /**
+     * @brief Method for getting underlying ringbuffer.
+     * It's synchronized with stream buffer state.
+     */
+    buffer_type& buffer()
+    {
+        synchronize();
+
+        return m_buffer;
+    }
+
+protected:
+
+    int_type overflow(int_type ch) override
+    {
+        synchronize();
+
+        if (traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+            return traits_type::not_eof(ch);
+        }
+
+        if (pptr() == epptr())
+        {
+            return traits_type::eof();
+        }
+
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+
+        return ch;
+    }
+
+    int_type underflow() override
+    {
+        synchronize();
+
+        if (gptr() == egptr())
+        {
+            return traits_type::eof();
+        }
+
+        return traits_type::to_int_type(*gptr());
+    }
+
+    std::streamsize showmanyc() override
+    {
+        synchronize();
+
+        return m_buffer.empty() ? -1 : static_cast<std::streamsize>(m_buffer.size());
+    }
+
+    int sync() override
+    {
+        synchronize();
+
+        return 0;
+    }
+
+private:
+
+    /**
+     * @brief Method for publishing written characters,
+     * popping read characters and exposing segments,
+     * that are current after that.
+     */
+    void synchronize()
+    {
+        auto written = static_cast<std::size_t>(pptr() - pbase());
+        auto read = static_cast<std::size_t>(gptr() - eback());
+
+        // Commit doesn't move front, so read characters
+        // stay valid
+        m_buffer.commit(written);
+        m_buffer.pop_front(read);
+
+        reset_areas();
+    }
+
+    void reset_areas()
+    {
+        auto free = m_buffer.first_free_segment();
+        auto used = m_buffer.first_segment();
+
+        setp(free.data, free.data + free.size);
+        setg(used.data, used.data, used.data + used.size);
+    }
+
+    buffer_type& m_buffer;
+};
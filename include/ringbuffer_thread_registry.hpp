@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ringbuffer_detail
+{
+    /**
+     * @brief Class, that describes registry of per thread
+     * entries. Thread gets own entry on first access (cached
+     * in thread_local storage). Entry of exited thread is
+     * reused by next new thread. Entries are never removed
+     * before registry destruction, so they may be traversed
+     * without locks. Thread local references to destroyed
+     * registries are swept, when thread misses its cache, so
+     * long living threads don't accumulate them.
+     * @tparam Entry Entry type. Must be default constructible
+     * and have `std::atomic<bool> claimed` member, that is
+     * true after construction.
+     */
+    template<typename Entry>
+    class thread_registry
+    {
+        struct node
+        {
+            std::shared_ptr<Entry> value;
+            node* next;
+        };
+
+        /**
+         * @brief Thread local reference to entry. Releases
+         * claim on thread exit. Entry is shared, so it
+         * outlives either registry or thread.
+         */
+        struct thread_entry
+        {
+            thread_entry(std::uint64_t owner, std::weak_ptr<const bool> lifetime, std::shared_ptr<Entry> value) :
+                owner(owner),
+                lifetime(std::move(lifetime)),
+                value(std::move(value))
+            {
+
+            }
+
+            thread_entry(thread_entry&& other) noexcept :
+                owner(other.owner),
+                lifetime(std::move(other.lifetime)),
+                value(std::move(other.value))
+            {
+
+            }
+
+            thread_entry& operator=(thread_entry&& other) noexcept
+            {
+                release();
+
+                owner = other.owner;
+                lifetime = std::move(other.lifetime);
+                value = std::move(other.value);
+
+                return *this;
+            }
+
+            ~thread_entry()
+            {
+                release();
+            }
+
+            void release()
+            {
+                if (value)
+                {
+                    value->claimed.store(false, std::memory_order_release);
+                }
+            }
+
+            std::uint64_t owner;
+            std::weak_ptr<const bool> lifetime;
+            std::shared_ptr<Entry> value;
+        };
+
+    public:
+
+        using size_type = std::size_t;
+
+        thread_registry() :
+            m_id(next_id()),
+            m_lifetime(std::make_shared<const bool>(true)),
+            m_nodes(nullptr),
+            m_size(0)
+        {
+
+        }
+
+        thread_registry(const thread_registry&) = delete;
+
+        thread_registry& operator=(const thread_registry&) = delete;
+
+        ~thread_registry()
+        {
+            auto* current = m_nodes.load(std::memory_order_acquire);
+
+            while (current != nullptr)
+            {
+                auto* next = current->next;
+                delete current;
+                current = next;
+            }
+        }
+
+        /**
+         * @brief Method for getting entry of current thread.
+         */
+        Entry& local()
+        {
+            static thread_local std::vector<thread_entry> entries;
+            static thread_local thread_entry* last = nullptr;
+
+            if (last != nullptr && last->owner == m_id)
+            {
+                return *last->value;
+            }
+
+            for (auto&& entry : entries)
+            {
+                if (entry.owner == m_id)
+                {
+                    last = &entry;
+                    return *entry.value;
+                }
+            }
+
+            // Dropping references to destroyed registries
+            entries.erase(
+                std::remove_if(entries.begin(), entries.end(), [](const thread_entry& entry)
+                {
+                    return entry.lifetime.expired();
+                }),
+                entries.end()
+            );
+
+            entries.emplace_back(m_id, m_lifetime, acquire());
+            last = &entries.back();
+
+            return *last->value;
+        }
+
+        /**
+         * @brief Method for traversing all entries
+         * (including released ones).
+         * @tparam Function Callable with `void(Entry&)` signature.
+         * @param function Function.
+         */
+        template<typename Function>
+        void for_each(Function function) const
+        {
+            for (auto* current = m_nodes.load(std::memory_order_acquire);
+                 current != nullptr;
+                 current = current->next)
+            {
+                function(*current->value);
+            }
+        }
+
+        /**
+         * @brief Method for getting number of created entries.
+         */
+        size_type size() const
+        {
+            return m_size.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        static std::uint64_t next_id()
+        {
+            static std::atomic<std::uint64_t> counter(0);
+
+            return ++counter;
+        }
+
+        std::shared_ptr<Entry> acquire()
+        {
+            // Reusing entry of exited thread
+            for (auto* current = m_nodes.load(std::memory_order_acquire);
+                 current != nullptr;
+                 current = current->next)
+            {
+                auto expected = false;
+
+                if (current->value->claimed.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                {
+                    return current->value;
+                }
+            }
+
+            auto* created = new node{std::make_shared<Entry>(), nullptr};
+
+            created->next = m_nodes.load(std::memory_order_relaxed);
+
+            while (!m_nodes.compare_exchange_weak(created->next, created,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed))
+            {
+
+            }
+
+            m_size.fetch_add(1, std::memory_order_relaxed);
+
+            return created->value;
+        }
+
+        const std::uint64_t m_id;
+        const std::shared_ptr<const bool> m_lifetime;
+        std::atomic<node*> m_nodes;
+        std::atomic<size_type> m_size;
+    };
+}
@@ -0,0 +1,487 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Operation, recorded into trace.
+ */
+enum class ringbuffer_trace_op : std::uint8_t
+{
+    push,     ///< `count` elements pushed to back.
+    pop,      ///< `count` elements popped from front.
+    iterate,  ///< All elements traversed.
+    clear     ///< Container cleared.
+};
+
+/**
+ * @brief Class, that describes recorded workload of
+ * ringbuffer: sequence of operations with timestamps.
+ * Events are kept encoded (operation byte, varint
+ * timestamp delta in nanoseconds, varint count), so
+ * usual event takes 3-4 bytes in memory and on disk.
+ */
+class ringbuffer_trace
+{
+public:
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Decoded event.
+     */
+    struct event
+    {
+        ringbuffer_trace_op op;
+        std::uint64_t count;
+        std::uint64_t timestamp;
+    };
+
+    ringbuffer_trace() :
+        m_data(),
+        m_size(0),
+        m_start(std::chrono::steady_clock::now()),
+        m_last(0)
+    {
+
+    }
+
+    /**
+     * @brief Method for recording event with current time.
+     * @param op Operation.
+     * @param count Number of affected elements.
+     */
+    void record(ringbuffer_trace_op op, std::uint64_t count = 1)
+    {
+        auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_start
+        ).count();
+
+        record(op, count, static_cast<std::uint64_t>(now));
+    }
+
+    /**
+     * @brief Method for recording event.
+     * @param op Operation.
+     * @param count Number of affected elements.
+     * @param timestamp Time in nanoseconds. Timestamps
+     * must not decrease.
+     */
+    void record(ringbuffer_trace_op op, std::uint64_t count, std::uint64_t timestamp)
+    {
+        if (timestamp < m_last)
+        {
+            timestamp = m_last;
+        }
+
+        m_data.push_back(static_cast<std::uint8_t>(op));
+        write_varint(timestamp - m_last);
+        write_varint(count);
+
+        m_last = timestamp;
+        ++m_size;
+    }
+
+    /**
+     * @brief Method for decoding all events.
+     */
+    std::vector<event> events() const
+    {
+        std::vector<event> result;
+        result.reserve(m_size);
+
+        std::uint64_t timestamp = 0;
+
+        for (size_type position = 0; position < m_data.size();)
+        {
+            event current;
+
+            current.op = static_cast<ringbuffer_trace_op>(m_data[position++]);
+            timestamp += read_varint(position);
+            current.timestamp = timestamp;
+            current.count = read_varint(position);
+
+            result.push_back(current);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Method for getting number of events.
+     */
+    size_type size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    /**
+     * @brief Method for getting size of encoded events.
+     */
+    size_type byte_size() const
+    {
+        return m_data.size();
+    }
+
+    /**
+     * @brief Method for clearing trace.
+     * Time is counted from this call.
+     */
+    void clear()
+    {
+        m_data.clear();
+        m_size = 0;
+        m_start = std::chrono::steady_clock::now();
+        m_last = 0;
+    }
+
+    /**
+     * @brief Method for writing trace in binary format.
+     * @param stream Output stream (opened in binary mode).
+     */
+    void save(std::ostream& stream) const
+    {
+        stream.write(magic(), MagicSize);
+
+        std::uint8_t header[16];
+
+        encode_fixed(header, m_size);
+        encode_fixed(header + 8, m_data.size());
+
+        stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+        stream.write(reinterpret_cast<const char*>(m_data.data()),
+                     static_cast<std::streamsize>(m_data.size()));
+    }
+
+    /**
+     * @brief Method for reading trace, written by `save`.
+     * Throws `std::runtime_error` if stream doesn't
+     * contain trace.
+     * @param stream Input stream (opened in binary mode).
+     * @return Trace.
+     */
+    static ringbuffer_trace load(std::istream& stream)
+    {
+        char stored[MagicSize];
+        std::uint8_t header[16];
+
+        if (!stream.read(stored, sizeof(stored)) ||
+            !std::equal(stored, stored + sizeof(stored), magic()) ||
+            !stream.read(reinterpret_cast<char*>(header), sizeof(header)))
+        {
+            throw std::runtime_error("Stream doesn't contain ringbuffer trace.");
+        }
+
+        ringbuffer_trace result;
+
+        result.m_size = static_cast<size_type>(decode_fixed(header));
+        result.m_data.resize(static_cast<size_type>(decode_fixed(header + 8)));
+
+        if (!stream.read(reinterpret_cast<char*>(result.m_data.data()),
+                         static_cast<std::streamsize>(result.m_data.size())))
+        {
+            throw std::runtime_error("Ringbuffer trace is truncated.");
+        }
+
+        auto events = result.events();
+
+        result.m_last = events.empty() ? 0 : events.back().timestamp;
+
+        return result;
+    }
+
+private:
+
+    enum : std::size_t { MagicSize = 8 };
+
+    /**
+     * @brief Method for getting file signature. Inline
+     * function keeps header includable from several
+     * translation units before C++17.
+     */
+    static const char* magic()
+    {
+        return "RBTRACE1";
+    }
+
+    void write_varint(std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            m_data.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+
+        m_data.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    std::uint64_t read_varint(size_type& position) const
+    {
+        std::uint64_t result = 0;
+
+        for (unsigned shift = 0; position < m_data.size(); shift += 7)
+        {
+            auto byte = m_data[position++];
+
+            result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    static void encode_fixed(std::uint8_t* data, std::uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            data[i] = static_cast<std::uint8_t>(value >> (i * 8));
+        }
+    }
+
+    static std::uint64_t decode_fixed(const std::uint8_t* data)
+    {
+        std::uint64_t result = 0;
+
+        for (int i = 0; i < 8; ++i)
+        {
+            result |= static_cast<std::uint64_t>(data[i]) << (i * 8);
+        }
+
+        return result;
+    }
+
+    std::vector<std::uint8_t> m_data;
+    size_type m_size;
+    std::chrono::steady_clock::time_point m_start;
+    std::uint64_t m_last;
+};
+
+/**
+ * @brief Class, that describes ringbuffer, that records
+ * its modifications into trace. Recording is opt-in:
+ * plain `ringbuffer` has no overhead.
+ * @tparam T Value type.
+ * @tparam Size Ringbuffer size.
+ */
+template<typename T, std::size_t Size>
+class recording_ringbuffer
+{
+public:
+
+    using value_type = T;
+
+    using const_reference = const T&;
+
+    using size_type = std::size_t;
+
+    using const_iterator = typename ringbuffer<T, Size>::const_iterator;
+
+    /**
+     * @brief Constructor.
+     * @param trace Trace, that must outlive ringbuffer.
+     */
+    explicit recording_ringbuffer(ringbuffer_trace& trace) :
+        m_buffer(),
+        m_trace(trace)
+    {
+
+    }
+
+    void push_back(const value_type& value)
+    {
+        m_trace.record(ringbuffer_trace_op::push);
+        m_buffer.push_back(value);
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        m_trace.record(ringbuffer_trace_op::push);
+        m_buffer.emplace_back(std::forward<Args>(args)...);
+    }
+
+    void pop_front()
+    {
+        m_buffer.pop_front();
+        m_trace.record(ringbuffer_trace_op::pop);
+    }
+
+    void pop_front(size_type count)
+    {
+        m_buffer.pop_front(count);
+        m_trace.record(ringbuffer_trace_op::pop, count);
+    }
+
+    /**
+     * @brief Method for traversing all elements.
+     * @tparam Function Callable with `void(const_reference)` signature.
+     * @param function Function.
+     */
+    template<typename Function>
+    void for_each(Function function) const
+    {
+        m_trace.record(ringbuffer_trace_op::iterate, m_buffer.size());
+        m_buffer.view().for_each(function);
+    }
+
+    void clear()
+    {
+        m_trace.record(ringbuffer_trace_op::clear);
+        m_buffer.clear();
+    }
+
+    const_reference front() const
+    {
+        return m_buffer.front();
+    }
+
+    const_reference back() const
+    {
+        return m_buffer.back();
+    }
+
+    const_reference operator[](size_type n) const
+    {
+        return m_buffer[n];
+    }
+
+    const_iterator begin() const
+    {
+        return m_buffer.begin();
+    }
+
+    const_iterator end() const
+    {
+        return m_buffer.end();
+    }
+
+    size_type size() const
+    {
+        return m_buffer.size();
+    }
+
+    size_type max_size() const
+    {
+        return Size;
+    }
+
+    bool empty() const
+    {
+        return m_buffer.empty();
+    }
+
+private:
+    ringbuffer<T, Size> m_buffer;
+    ringbuffer_trace& m_trace;
+};
+
+namespace ringbuffer_detail
+{
+    template<typename Ring, typename Function>
+    auto trace_iterate(Ring& ring, Function& function, int) -> decltype(ring.begin(), void())
+    {
+        for (auto&& el : ring)
+        {
+            function(el);
+        }
+    }
+
+    template<typename Ring, typename Function>
+    void trace_iterate(Ring& ring, Function& function, long)
+    {
+        ring.for_each_segment([&function](decltype(ring.front_segment()) segment)
+        {
+            segment.for_each(function);
+        });
+    }
+}
+
+/**
+ * @brief Function for replaying recorded workload on any
+ * ringbuffer variant. Ring must provide `push_back`,
+ * `pop_front`, `pop_front(count)`, `size`, `clear` and
+ * either range iteration or `for_each_segment`.
+ * Pops are limited by number of stored elements, so
+ * variants with smaller capacity don't fail.
+ * @tparam Ring Ringbuffer type.
+ * @tparam Function Callable with `void(const value_type&)`
+ * signature, that is called for traversed elements.
+ * @param events Decoded events.
+ * @param ring Ringbuffer.
+ * @param value Pushed value.
+ * @param function Function.
+ * @param paced Keep original pacing between events
+ * (busy waiting) instead of running at full speed.
+ */
+template<typename Ring, typename Function>
+void ringbuffer_trace_replay(const std::vector<ringbuffer_trace::event>& events,
+                             Ring& ring,
+                             const typename Ring::value_type& value,
+                             Function function,
+                             bool paced = false)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto first = events.empty() ? 0 : events.front().timestamp;
+
+    for (auto&& event : events)
+    {
+        if (paced)
+        {
+            auto due = start + std::chrono::nanoseconds(event.timestamp - first);
+
+            while (std::chrono::steady_clock::now() < due)
+            {
+
+            }
+        }
+
+        switch (event.op)
+        {
+        case ringbuffer_trace_op::push:
+            for (std::uint64_t i = 0; i < event.count; ++i)
+            {
+                ring.push_back(value);
+            }
+            break;
+
+        case ringbuffer_trace_op::pop:
+            if (event.count == 1)
+            {
+                if (ring.size() != 0)
+                {
+                    ring.pop_front();
+                }
+            }
+            else
+            {
+                ring.pop_front(std::min<std::size_t>(static_cast<std::size_t>(event.count), ring.size()));
+            }
+            break;
+
+        case ringbuffer_trace_op::iterate:
+            ringbuffer_detail::trace_iterate(ring, function, 0);
+            break;
+
+        case ringbuffer_trace_op::clear:
+            ring.clear();
+            break;
+        }
+    }
+}
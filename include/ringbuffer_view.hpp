@@ -0,0 +1,565 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+
+namespace ringbuffer_detail
+{
+#if defined(__cpp_lib_ranges)
+    using view_base = std::ranges::view_base;
+#else
+    struct view_base
+    {
+
+    };
+#endif
+
+    /**
+     * @brief Random access iterator over view, that
+     * provides `operator[]`. Iterator stores copy of
+     * (small) view, so it doesn't dangle, when view
+     * is destroyed.
+     * @tparam View View type.
+     */
+    template<typename View>
+    class index_iterator
+    {
+    public:
+
+        using reference = decltype(std::declval<const View&>()[0]);
+
+        using value_type = typename std::decay<reference>::type;
+
+        using difference_type = std::ptrdiff_t;
+
+        using pointer = typename std::conditional<
+            std::is_reference<reference>::value,
+            typename std::add_pointer<reference>::type,
+            void
+        >::type;
+
+        using iterator_category = typename std::conditional<
+            std::is_reference<reference>::value,
+            std::random_access_iterator_tag,
+            std::input_iterator_tag
+        >::type;
+
+#if defined(__cpp_lib_ranges)
+        using iterator_concept = std::random_access_iterator_tag;
+#endif
+
+        index_iterator() :
+            m_view(),
+            m_index(0)
+        {
+
+        }
+
+        index_iterator(const View& view, std::size_t index) :
+            m_view(view),
+            m_index(index)
+        {
+
+        }
+
+        reference operator*() const
+        {
+            return m_view[m_index];
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return m_view[m_index + n];
+        }
+
+        index_iterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+
+        index_iterator operator++(int)
+        {
+            index_iterator retval = *this;
+            ++m_index;
+            return retval;
+        }
+
+        index_iterator& operator--()
+        {
+            --m_index;
+            return *this;
+        }
+
+        index_iterator operator--(int)
+        {
+            index_iterator retval = *this;
+            --m_index;
+            return retval;
+        }
+
+        index_iterator& operator+=(difference_type n)
+        {
+            m_index += n;
+            return *this;
+        }
+
+        index_iterator& operator-=(difference_type n)
+        {
+            m_index -= n;
+            return *this;
+        }
+
+        index_iterator operator+(difference_type n) const
+        {
+            return index_iterator(m_view, m_index + n);
+        }
+
+        friend index_iterator operator+(difference_type n, const index_iterator& iterator)
+        {
+            return iterator + n;
+        }
+
+        index_iterator operator-(difference_type n) const
+        {
+            return index_iterator(m_view, m_index - n);
+        }
+
+        difference_type operator-(const index_iterator& other) const
+        {
+            return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+        }
+
+        bool operator==(const index_iterator& other) const
+        {
+            return m_index == other.m_index;
+        }
+
+        bool operator!=(const index_iterator& other) const
+        {
+            return m_index != other.m_index;
+        }
+
+        bool operator<(const index_iterator& other) const
+        {
+            return m_index < other.m_index;
+        }
+
+        bool operator>(const index_iterator& other) const
+        {
+            return m_index > other.m_index;
+        }
+
+        bool operator<=(const index_iterator& other) const
+        {
+            return m_index <= other.m_index;
+        }
+
+        bool operator>=(const index_iterator& other) const
+        {
+            return m_index >= other.m_index;
+        }
+
+    private:
+        View m_view;
+        std::size_t m_index;
+    };
+}
+
+/**
+ * @brief Class, that describes non-owning view of
+ * ringbuffer elements (or part of them). Elements
+ * are stored in at most two contiguous segments.
+ * Loops over segments (`for_each`, `first_segment`,
+ * `second_segment`) are vectorizable, iterators
+ * provide random access.
+ * View is invalidated by any change of ringbuffer.
+ * @tparam T Element type (const for read only view).
+ */
+template<typename T>
+class ringbuffer_span : public ringbuffer_detail::view_base
+{
+public:
+
+    using value_type = typename std::remove_const<T>::type;
+
+    using reference = T&;
+
+    using pointer = T*;
+
+    using size_type = std::size_t;
+
+    using difference_type = std::ptrdiff_t;
+
+    using iterator = ringbuffer_detail::index_iterator<ringbuffer_span>;
+
+    using const_iterator = iterator;
+
+    /**
+     * @brief Contiguous part of view.
+     */
+    struct segment
+    {
+        pointer data;
+        size_type size;
+    };
+
+    ringbuffer_span() :
+        m_first(nullptr),
+        m_firstSize(0),
+        m_second(nullptr),
+        m_secondSize(0)
+    {
+
+    }
+
+    /**
+     * @brief Constructor.
+     * @param first First segment.
+     * @param firstSize Number of elements in first segment.
+     * @param second Second segment.
+     * @param secondSize Number of elements in second segment.
+     */
+    ringbuffer_span(pointer first, size_type firstSize, pointer second, size_type secondSize) :
+        m_first(first),
+        m_firstSize(firstSize),
+        m_second(second),
+        m_secondSize(secondSize)
+    {
+
+    }
+
+    /**
+     * @brief Conversion from mutable view to read only view.
+     * @param other Mutable view.
+     */
+    template<typename U,
+             typename = typename std::enable_if<std::is_same<const U, T>::value &&
+                                                !std::is_same<U, T>::value>::type>
+    ringbuffer_span(const ringbuffer_span<U>& other) :
+        m_first(other.first_segment().data),
+        m_firstSize(other.first_segment().size),
+        m_second(other.second_segment().data),
+        m_secondSize(other.second_segment().size)
+    {
+
+    }
+
+    reference operator[](size_type n) const
+    {
+        return n < m_firstSize ? m_first[n] : m_second[n - m_firstSize];
+    }
+
+    reference front() const
+    {
+        return (*this)[0];
+    }
+
+    reference back() const
+    {
+        return (*this)[size() - 1];
+    }
+
+    size_type size() const
+    {
+        return m_firstSize + m_secondSize;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    iterator begin() const
+    {
+        return iterator(*this, 0);
+    }
+
+    iterator end() const
+    {
+        return iterator(*this, size());
+    }
+
+    segment first_segment() const
+    {
+        return {m_first, m_firstSize};
+    }
+
+    segment second_segment() const
+    {
+        return {m_second, m_secondSize};
+    }
+
+    /**
+     * @brief Method for getting part of view.
+     * @param offset Index of first element.
+     * @param count Number of elements.
+     * @return View of [offset, offset + count) elements.
+     */
+    ringbuffer_span subspan(size_type offset, size_type count) const
+    {
+        if (offset > size() || count > size() - offset)
+        {
+            throw std::out_of_range("Index is out of range.");
+        }
+
+        if (offset >= m_firstSize)
+        {
+            return ringbuffer_span(m_second + (offset - m_firstSize), count, m_second, 0);
+        }
+
+        auto first = std::min(count, m_firstSize - offset);
+
+        return ringbuffer_span(m_first + offset, first, m_second, count - first);
+    }
+
+    /**
+     * @brief Method for traversing elements
+     * segment by segment.
+     * @tparam Function Callable with `void(reference)` signature.
+     * @param function Function.
+     */
+    template<typename Function>
+    void for_each(Function function) const
+    {
+        for (size_type i = 0; i < m_firstSize; ++i)
+        {
+            function(m_first[i]);
+        }
+
+        for (size_type i = 0; i < m_secondSize; ++i)
+        {
+            function(m_second[i]);
+        }
+    }
+
+private:
+    pointer m_first;
+    size_type m_firstSize;
+    pointer m_second;
+    size_type m_secondSize;
+};
+
+/**
+ * @brief Class, that describes view of every n-th
+ * element of ringbuffer span (starting from first one).
+ * @tparam T Element type.
+ */
+template<typename T>
+class ringbuffer_stride_view : public ringbuffer_detail::view_base
+{
+public:
+
+    using value_type = typename std::remove_const<T>::type;
+
+    using reference = T&;
+
+    using size_type = std::size_t;
+
+    using difference_type = std::ptrdiff_t;
+
+    using iterator = ringbuffer_detail::index_iterator<ringbuffer_stride_view>;
+
+    using const_iterator = iterator;
+
+    ringbuffer_stride_view() :
+        m_span(),
+        m_stride(1)
+    {
+
+    }
+
+    /**
+     * @brief Constructor.
+     * @param span Viewed elements.
+     * @param stride Distance between elements. Must be positive.
+     */
+    ringbuffer_stride_view(const ringbuffer_span<T>& span, size_type stride) :
+        m_span(span),
+        m_stride(stride)
+    {
+        if (stride == 0)
+        {
+            throw std::invalid_argument("Stride must be positive.");
+        }
+    }
+
+    reference operator[](size_type n) const
+    {
+        return m_span[n * m_stride];
+    }
+
+    size_type size() const
+    {
+        return (m_span.size() + m_stride - 1) / m_stride;
+    }
+
+    bool empty() const
+    {
+        return m_span.empty();
+    }
+
+    size_type stride() const
+    {
+        return m_stride;
+    }
+
+    iterator begin() const
+    {
+        return iterator(*this, 0);
+    }
+
+    iterator end() const
+    {
+        return iterator(*this, size());
+    }
+
+    /**
+     * @brief Method for traversing elements
+     * segment by segment.
+     * @tparam Function Callable with `void(reference)` signature.
+     * @param function Function.
+     */
+    template<typename Function>
+    void for_each(Function function) const
+    {
+        auto first = m_span.first_segment();
+        auto second = m_span.second_segment();
+
+        for (size_type i = 0; i < first.size; i += m_stride)
+        {
+            function(first.data[i]);
+        }
+
+        // Continuing stride phase from first segment
+        for (size_type i = (m_stride - first.size % m_stride) % m_stride; i < second.size; i += m_stride)
+        {
+            function(second.data[i]);
+        }
+    }
+
+private:
+    ringbuffer_span<T> m_span;
+    size_type m_stride;
+};
+
+/**
+ * @brief Class, that describes view of ringbuffer span
+ * split into consecutive chunks (spans) of fixed size.
+ * Last chunk may be shorter.
+ * @tparam T Element type.
+ */
+template<typename T>
+class ringbuffer_chunk_view : public ringbuffer_detail::view_base
+{
+public:
+
+    using value_type = ringbuffer_span<T>;
+
+    using reference = ringbuffer_span<T>;
+
+    using size_type = std::size_t;
+
+    using difference_type = std::ptrdiff_t;
+
+    using iterator = ringbuffer_detail::index_iterator<ringbuffer_chunk_view>;
+
+    using const_iterator = iterator;
+
+    ringbuffer_chunk_view() :
+        m_span(),
+        m_chunkSize(1)
+    {
+
+    }
+
+    /**
+     * @brief Constructor.
+     * @param span Viewed elements.
+     * @param chunkSize Number of elements in chunk. Must be positive.
+     */
+    ringbuffer_chunk_view(const ringbuffer_span<T>& span, size_type chunkSize) :
+        m_span(span),
+        m_chunkSize(chunkSize)
+    {
+        if (chunkSize == 0)
+        {
+            throw std::invalid_argument("Chunk size must be positive.");
+        }
+    }
+
+    ringbuffer_span<T> operator[](size_type n) const
+    {
+        auto offset = n * m_chunkSize;
+
+        return m_span.subspan(offset, std::min(m_chunkSize, m_span.size() - offset));
+    }
+
+    size_type size() const
+    {
+        return (m_span.size() + m_chunkSize - 1) / m_chunkSize;
+    }
+
+    bool empty() const
+    {
+        return m_span.empty();
+    }
+
+    size_type chunk_size() const
+    {
+        return m_chunkSize;
+    }
+
+    iterator begin() const
+    {
+        return iterator(*this, 0);
+    }
+
+    iterator end() const
+    {
+        return iterator(*this, size());
+    }
+
+    /**
+     * @brief Method for traversing chunks.
+     * @tparam Function Callable with `void(ringbuffer_span<T>)` signature.
+     * @param function Function.
+     */
+    template<typename Function>
+    void for_each(Function function) const
+    {
+        for (size_type i = 0, count = size(); i < count; ++i)
+        {
+            function((*this)[i]);
+        }
+    }
+
+private:
+    ringbuffer_span<T> m_span;
+    size_type m_chunkSize;
+};
+
+#if defined(__cpp_lib_ranges)
+namespace std
+{
+    namespace ranges
+    {
+        template<typename T>
+        inline constexpr bool enable_borrowed_range<ringbuffer_span<T>> = true;
+
+        template<typename T>
+        inline constexpr bool enable_borrowed_range<ringbuffer_stride_view<T>> = true;
+
+        template<typename T>
+        inline constexpr bool enable_borrowed_range<ringbuffer_chunk_view<T>> = true;
+    }
+}
+#endif
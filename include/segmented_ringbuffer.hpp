@@ -0,0 +1,362 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Class, that describes unbounded queue, built
+ * from chain of fixed size ringbuffer segments.
+ * When tail segment is full, new segment is appended.
+ * Drained segments are kept in small free list and are
+ * reused, so steady state doesn't allocate. If queue
+ * fits into one segment, it works as plain ringbuffer.
+ * Unlike `ringbuffer` it never overwrites elements.
+ * @tparam T Value type.
+ * @tparam SegmentSize Number of elements in one segment.
+ */
+template<typename T, std::size_t SegmentSize>
+class segmented_ringbuffer
+{
+    using segment_buffer = ringbuffer<T, SegmentSize>;
+
+    struct segment_node
+    {
+        segment_node() :
+            buffer(),
+            next(nullptr)
+        {
+
+        }
+
+        segment_buffer buffer;
+        segment_node* next;
+    };
+
+public:
+
+    using value_type = T;
+
+    using reference = T&;
+
+    using const_reference = const T&;
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructor.
+     * @param freeLimit Maximum number of drained segments,
+     * kept for reuse.
+     */
+    explicit segmented_ringbuffer(size_type freeLimit = 4) :
+        m_head(nullptr),
+        m_tail(nullptr),
+        m_free(nullptr),
+        m_segmentCount(0),
+        m_freeCount(0),
+        m_freeLimit(freeLimit)
+    {
+
+    }
+
+    segmented_ringbuffer(const segmented_ringbuffer&) = delete;
+
+    segmented_ringbuffer& operator=(const segmented_ringbuffer&) = delete;
+
+    ~segmented_ringbuffer()
+    {
+        destroy(m_head);
+        destroy(m_free);
+    }
+
+    /**
+     * @brief Method for pushing back element.
+     * @param value Value.
+     */
+    void push_back(const value_type& value)
+    {
+        tail_segment().push_back(value);
+    }
+
+    /**
+     * @brief Method for constructing element at the end.
+     * @param args Constructor arguments.
+     */
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        tail_segment().emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Method for popping element from front.
+     * Drained segment is released to free list.
+     */
+    void pop_front()
+    {
+        if (m_head == nullptr)
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        m_head->buffer.pop_front();
+
+        if (m_head->buffer.empty())
+        {
+            release_head();
+        }
+    }
+
+    /**
+     * @brief Method for popping several elements from front.
+     * @param count Number of elements.
+     */
+    void pop_front(size_type count)
+    {
+        if (count > size())
+        {
+            throw std::overflow_error("Not enough elements.");
+        }
+
+        while (count != 0)
+        {
+            auto current = std::min(count, m_head->buffer.size());
+
+            m_head->buffer.pop_front(current);
+            count -= current;
+
+            if (m_head->buffer.empty())
+            {
+                release_head();
+            }
+        }
+    }
+
+    /**
+     * @brief Method for getting front element.
+     * Throws `std::overflow_error` if container is empty.
+     */
+    reference front()
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        return m_head->buffer.front();
+    }
+
+    const_reference front() const
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        return m_head->buffer.front();
+    }
+
+    /**
+     * @brief Method for getting back element.
+     * Throws `std::overflow_error` if container is empty.
+     */
+    reference back()
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        return m_tail->buffer.back();
+    }
+
+    const_reference back() const
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        return m_tail->buffer.back();
+    }
+
+    /**
+     * @brief Method for getting view of elements
+     * in front segment.
+     */
+    ringbuffer_span<value_type> front_segment()
+    {
+        return m_head == nullptr ? ringbuffer_span<value_type>() : m_head->buffer.view();
+    }
+
+    /**
+     * @brief Method for traversing elements
+     * segment by segment.
+     * @tparam Function Callable with `void(ringbuffer_span<value_type>)` signature.
+     * @param function Function.
+     */
+    template<typename Function>
+    void for_each_segment(Function function)
+    {
+        for (auto* node = m_head; node != nullptr; node = node->next)
+        {
+            function(node->buffer.view());
+        }
+    }
+
+    /**
+     * @brief Method for traversing elements
+     * segment by segment.
+     * @tparam Function Callable with `void(ringbuffer_span<const value_type>)` signature.
+     * @param function Function.
+     */
+    template<typename Function>
+    void for_each_segment(Function function) const
+    {
+        for (const segment_node* node = m_head; node != nullptr; node = node->next)
+        {
+            function(node->buffer.view());
+        }
+    }
+
+    size_type size() const
+    {
+        if (m_head == m_tail)
+        {
+            return m_head == nullptr ? 0 : m_head->buffer.size();
+        }
+
+        // Segments between head and tail are always full
+        return m_head->buffer.size() +
+               (m_segmentCount - 2) * SegmentSize +
+               m_tail->buffer.size();
+    }
+
+    bool empty() const
+    {
+        return m_head == nullptr || m_head->buffer.empty();
+    }
+
+    /**
+     * @brief Method for getting number of segments,
+     * that hold elements.
+     */
+    size_type segment_count() const
+    {
+        return m_segmentCount;
+    }
+
+    /**
+     * @brief Method for getting number of drained
+     * segments, kept for reuse.
+     */
+    size_type free_segment_count() const
+    {
+        return m_freeCount;
+    }
+
+    /**
+     * @brief Method for clearing container.
+     * Segments are released to free list.
+     */
+    void clear()
+    {
+        while (m_head != nullptr)
+        {
+            m_head->buffer.clear();
+
+            auto* node = m_head;
+            m_head = node->next;
+
+            recycle(node);
+        }
+
+        m_tail = nullptr;
+        m_segmentCount = 0;
+    }
+
+private:
+
+    segment_buffer& tail_segment()
+    {
+        if (m_tail != nullptr && m_tail->buffer.size() < SegmentSize)
+        {
+            return m_tail->buffer;
+        }
+
+        auto* node = m_free;
+
+        if (node != nullptr)
+        {
+            m_free = node->next;
+            node->next = nullptr;
+            --m_freeCount;
+        }
+        else
+        {
+            node = new segment_node();
+        }
+
+        if (m_tail == nullptr)
+        {
+            m_head = node;
+        }
+        else
+        {
+            m_tail->next = node;
+        }
+
+        m_tail = node;
+        ++m_segmentCount;
+
+        return node->buffer;
+    }
+
+    void release_head()
+    {
+        // Last segment stays, so push/pop around
+        // one element doesn't move segments
+        if (m_head == m_tail)
+        {
+            return;
+        }
+
+        auto* node = m_head;
+        m_head = node->next;
+        --m_segmentCount;
+
+        recycle(node);
+    }
+
+    void recycle(segment_node* node)
+    {
+        if (m_freeCount >= m_freeLimit)
+        {
+            delete node;
+            return;
+        }
+
+        node->next = m_free;
+        m_free = node;
+        ++m_freeCount;
+    }
+
+    static void destroy(segment_node* node)
+    {
+        while (node != nullptr)
+        {
+            auto* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    segment_node* m_head;
+    segment_node* m_tail;
+    segment_node* m_free;
+    size_type m_segmentCount;
+    size_type m_freeCount;
+    size_type m_freeLimit;
+};
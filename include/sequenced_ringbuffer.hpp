@@ -0,0 +1,350 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "ringbuffer.hpp"
+
+/**
+ * @brief Result of reading with cursor.
+ */
+struct ringbuffer_read_result
+{
+    /**
+     * @brief Number of elements, that were overwritten
+     * (or popped) before cursor reached them.
+     */
+    std::uint64_t missed;
+
+    /**
+     * @brief Number of read elements.
+     */
+    std::size_t read;
+};
+
+/**
+ * @brief Class, that describes ringbuffer, that assigns
+ * monotonic 64-bit sequence number to every pushed
+ * element (first element gets 0). Element is found by
+ * sequence in O(1), because sequences of stored elements
+ * are consecutive. Consumers keep cursors (sequence of
+ * next element to read), so after reconnect they read
+ * only missed tail and learn, how many elements were
+ * lost in between.
+ * @tparam T Value type.
+ * @tparam Size Ringbuffer size.
+ */
+template<typename T, std::size_t Size>
+class sequenced_ringbuffer
+{
+public:
+
+    using value_type = T;
+
+    using reference = T&;
+
+    using const_reference = const T&;
+
+    using size_type = std::size_t;
+
+    using sequence_type = std::uint64_t;
+
+    using const_iterator = typename ringbuffer<T, Size>::const_iterator;
+
+    /**
+     * @brief Class, that describes position of consumer:
+     * sequence of next element to read.
+     */
+    class cursor
+    {
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param sequence Sequence of next element to read.
+         */
+        explicit cursor(sequence_type sequence = 0) :
+            m_sequence(sequence)
+        {
+
+        }
+
+        sequence_type sequence() const
+        {
+            return m_sequence;
+        }
+
+    private:
+        friend class sequenced_ringbuffer;
+
+        sequence_type m_sequence;
+    };
+
+    sequenced_ringbuffer() :
+        m_buffer(),
+        m_nextSequence(0)
+    {
+
+    }
+
+    /**
+     * @brief Constructor.
+     * @param firstSequence Sequence of first pushed element
+     * (e.g. to continue numbering after restart).
+     */
+    explicit sequenced_ringbuffer(sequence_type firstSequence) :
+        m_buffer(),
+        m_nextSequence(firstSequence)
+    {
+
+    }
+
+    /**
+     * @brief Method for pushing back element.
+     * If not enough space left, oldest element
+     * will be overwritten.
+     * @param value Value.
+     * @return Sequence of pushed element.
+     */
+    sequence_type push_back(const value_type& value)
+    {
+        m_buffer.push_back(value);
+
+        return m_nextSequence++;
+    }
+
+    /**
+     * @brief Method for constructing element at the end.
+     * @param args Constructor arguments.
+     * @return Sequence of pushed element.
+     */
+    template<typename... Args>
+    sequence_type emplace_back(Args&&... args)
+    {
+        m_buffer.emplace_back(std::forward<Args>(args)...);
+
+        return m_nextSequence++;
+    }
+
+    void pop_front()
+    {
+        m_buffer.pop_front();
+    }
+
+    void pop_front(size_type count)
+    {
+        m_buffer.pop_front(count);
+    }
+
+    /**
+     * @brief Method for clearing container.
+     * Numbering continues.
+     */
+    void clear()
+    {
+        m_buffer.clear();
+    }
+
+    /**
+     * @brief Method for getting sequence of front
+     * element (`next_seq()` if container is empty).
+     */
+    sequence_type first_seq() const
+    {
+        return m_nextSequence - m_buffer.size();
+    }
+
+    /**
+     * @brief Method for getting sequence of back element.
+     * Throws `std::overflow_error` if container is empty.
+     */
+    sequence_type last_seq() const
+    {
+        if (m_buffer.empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        return m_nextSequence - 1;
+    }
+
+    /**
+     * @brief Method for getting sequence, that will be
+     * assigned to next pushed element.
+     */
+    sequence_type next_seq() const
+    {
+        return m_nextSequence;
+    }
+
+    bool contains_seq(sequence_type sequence) const
+    {
+        return sequence >= first_seq() && sequence < m_nextSequence;
+    }
+
+    /**
+     * @brief Method for getting element by sequence.
+     * Throws `std::out_of_range` if element is not stored
+     * (already overwritten or not pushed yet).
+     * @param sequence Sequence.
+     */
+    reference at_seq(sequence_type sequence)
+    {
+        return m_buffer[index_of(sequence)];
+    }
+
+    const_reference at_seq(sequence_type sequence) const
+    {
+        return m_buffer[index_of(sequence)];
+    }
+
+    /**
+     * @brief Method for getting view of elements,
+     * starting with sequence (clamped to stored ones).
+     * @param sequence Sequence of first element.
+     */
+    ringbuffer_span<const value_type> view_from(sequence_type sequence) const
+    {
+        auto first = std::max(sequence, first_seq());
+        auto offset = static_cast<size_type>(std::min(first, m_nextSequence) - first_seq());
+
+        return m_buffer.view().subspan(offset, m_buffer.size() - offset);
+    }
+
+    /**
+     * @brief Method for getting cursor, that resumes
+     * reading from sequence.
+     * @param sequence Sequence of next element to read.
+     */
+    cursor resume(sequence_type sequence) const
+    {
+        return cursor(sequence);
+    }
+
+    /**
+     * @brief Method for getting cursor, that reads
+     * only elements, pushed after this call.
+     */
+    cursor tail_cursor() const
+    {
+        return cursor(m_nextSequence);
+    }
+
+    /**
+     * @brief Method for reading elements after cursor
+     * and advancing it. If elements after cursor were
+     * already overwritten, cursor skips them and they are
+     * reported as missed.
+     * @tparam Function Callable with `void(sequence_type, const_reference)` signature.
+     * @param position Cursor.
+     * @param function Function.
+     * @param count Maximum number of elements.
+     * @return Number of missed and read elements.
+     */
+    template<typename Function>
+    ringbuffer_read_result read(cursor& position, Function function, size_type count = Size) const
+    {
+        ringbuffer_read_result result{0, 0};
+
+        auto first = first_seq();
+
+        if (position.m_sequence < first)
+        {
+            result.missed = first - position.m_sequence;
+            position.m_sequence = first;
+        }
+
+        if (position.m_sequence >= m_nextSequence)
+        {
+            return result;
+        }
+
+        auto offset = static_cast<size_type>(position.m_sequence - first);
+
+        result.read = std::min(count, m_buffer.size() - offset);
+
+        auto sequence = position.m_sequence;
+
+        m_buffer.view().subspan(offset, result.read).for_each([&function, &sequence](const_reference el)
+        {
+            function(sequence++, el);
+        });
+
+        position.m_sequence += result.read;
+
+        return result;
+    }
+
+    reference front()
+    {
+        return m_buffer.front();
+    }
+
+    const_reference front() const
+    {
+        return m_buffer.front();
+    }
+
+    reference back()
+    {
+        return m_buffer.back();
+    }
+
+    const_reference back() const
+    {
+        return m_buffer.back();
+    }
+
+    reference operator[](size_type n)
+    {
+        return m_buffer[n];
+    }
+
+    const_reference operator[](size_type n) const
+    {
+        return m_buffer[n];
+    }
+
+    const_iterator begin() const
+    {
+        return m_buffer.begin();
+    }
+
+    const_iterator end() const
+    {
+        return m_buffer.end();
+    }
+
+    size_type size() const
+    {
+        return m_buffer.size();
+    }
+
+    size_type max_size() const
+    {
+        return Size;
+    }
+
+    bool empty() const
+    {
+        return m_buffer.empty();
+    }
+
+private:
+
+    size_type index_of(sequence_type sequence) const
+    {
+        if (!contains_seq(sequence))
+        {
+            throw std::out_of_range("Index is out of range.");
+        }
+
+        return static_cast<size_type>(sequence - first_seq());
+    }
+
+    ringbuffer<T, Size> m_buffer;
+    sequence_type m_nextSequence;
+};
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ringbuffer_thread_registry.hpp"
+#include "spsc_ringbuffer.hpp"
+
+/**
+ * @brief Class, that describes multi producer collector
+ * built from per thread single producer ringbuffers.
+ * Writer thread gets own shard on first push (cached
+ * in thread_local storage), so writers don't share
+ * cache lines. Single collector thread drains shards
+ * in batches, optionally merging them by timestamp.
+ * Shard of exited thread is reused by next new writer.
+ * @tparam T Value type.
+ * @tparam ShardSize Size of every shard.
+ */
+template<typename T, std::size_t ShardSize>
+class sharded_ringbuffer
+{
+    struct shard
+    {
+        shard() :
+            buffer(),
+            dropped(0),
+            claimed(true)
+        {
+
+        }
+
+        spsc_ringbuffer<T, ShardSize> buffer;
+        alignas(64) std::atomic<std::uint64_t> dropped;
+        std::atomic<bool> claimed;
+    };
+
+public:
+
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    sharded_ringbuffer() :
+        m_shards()
+    {
+
+    }
+
+    sharded_ringbuffer(const sharded_ringbuffer&) = delete;
+
+    sharded_ringbuffer& operator=(const sharded_ringbuffer&) = delete;
+
+    /**
+     * @brief Method for pushing value into shard of
+     * current thread.
+     * @param value Value.
+     * @return False if shard is full and value was dropped.
+     */
+    bool push_back(const value_type& value)
+    {
+        auto& current = m_shards.local();
+
+        if (!current.buffer.push(value))
+        {
+            current.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Method for reserving free slots in shard
+     * of current thread. Values are published by `commit`
+     * from the same thread.
+     * @param count Number of slots.
+     * @return View of at most `count` free slots.
+     */
+    ringbuffer_span<value_type> reserve(size_type count)
+    {
+        return m_shards.local().buffer.reserve(count);
+    }
+
+    /**
+     * @brief Method for publishing values, that were
+     * constructed in slots returned by `reserve`.
+     * @param count Number of values.
+     */
+    void commit(size_type count)
+    {
+        m_shards.local().buffer.commit(count);
+    }
+
+    /**
+     * @brief Method for draining all shards.
+     * May be called only by single collector thread.
+     * @tparam Function Callable with `void(value_type&)` signature.
+     * @param function Function.
+     * @param batch Maximum number of values taken from
+     * one shard.
+     * @return Number of drained values.
+     */
+    template<typename Function>
+    size_type drain(Function function, size_type batch = ShardSize)
+    {
+        size_type result = 0;
+
+        m_shards.for_each([&result, &function, batch](shard& current)
+        {
+            result += current.buffer.consume(std::ref(function), batch);
+        });
+
+        return result;
+    }
+
+    /**
+     * @brief Method for draining all shards in timestamp
+     * order. Values of every shard must be pushed with non
+     * decreasing timestamps. Order is guaranteed among
+     * values, that are drained by one call.
+     * May be called only by single collector thread.
+     * @tparam Function Callable with `void(value_type&)` signature.
+     * @tparam Timestamp Callable, that returns comparable
+     * timestamp of value.
+     * @param function Function.
+     * @param timestamp Timestamp extractor.
+     * @return Number of drained values.
+     */
+    template<typename Function, typename Timestamp>
+    size_type drain_ordered(Function function, Timestamp timestamp)
+    {
+        using timestamp_type = typename std::decay<decltype(timestamp(std::declval<const T&>()))>::type;
+
+        struct cursor
+        {
+            timestamp_type timestamp;
+            spsc_ringbuffer<T, ShardSize>* buffer;
+            size_type remaining;
+        };
+
+        auto later = [](const cursor& lhs, const cursor& rhs)
+        {
+            return rhs.timestamp < lhs.timestamp;
+        };
+
+        std::vector<cursor> heap;
+        heap.reserve(shard_count());
+
+        // Snapshot of available values limits merge, so
+        // fast writer can't starve it
+        m_shards.for_each([&heap, &timestamp](shard& current)
+        {
+            auto& buffer = current.buffer;
+            auto* front = buffer.front();
+
+            if (front != nullptr)
+            {
+                heap.push_back(cursor{timestamp(*front), &buffer, buffer.size()});
+            }
+        });
+
+        std::make_heap(heap.begin(), heap.end(), later);
+
+        size_type result = 0;
+
+        while (!heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end(), later);
+
+            auto& current = heap.back();
+
+            function(*current.buffer->front());
+            current.buffer->pop_front();
+            ++result;
+
+            if (--current.remaining == 0)
+            {
+                heap.pop_back();
+                continue;
+            }
+
+            current.timestamp = timestamp(*current.buffer->front());
+            std::push_heap(heap.begin(), heap.end(), later);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Method for getting number of values,
+     * dropped because of full shards.
+     */
+    std::uint64_t dropped() const
+    {
+        std::uint64_t result = 0;
+
+        m_shards.for_each([&result](shard& current)
+        {
+            result += current.dropped.load(std::memory_order_relaxed);
+        });
+
+        return result;
+    }
+
+    /**
+     * @brief Method for getting number of created shards.
+     */
+    size_type shard_count() const
+    {
+        return m_shards.size();
+    }
+
+private:
+    ringbuffer_detail::thread_registry<shard> m_shards;
+};
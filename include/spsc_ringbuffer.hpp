@@ -0,0 +1,266 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "ringbuffer_view.hpp"
+
+/**
+ * @brief Class, that describes lock-free single producer,
+ * single consumer ringbuffer.
+ * Producer and consumer indices are placed on separate
+ * cache lines. Each side caches last seen index of other
+ * side, so shared cache line is touched only when
+ * ringbuffer looks full (or empty).
+ * Unlike `ringbuffer` it never overwrites: `push`
+ * fails if there is no free space.
+ * @tparam T Value type.
+ * @tparam Size Ringbuffer size.
+ */
+template<typename T, std::size_t Size>
+class spsc_ringbuffer
+{
+    static_assert(Size > 0, "Empty ringbuffer is not allowed.");
+
+public:
+
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    spsc_ringbuffer() :
+        m_tail(0),
+        m_cachedHead(0),
+        m_head(0),
+        m_cachedTail(0),
+        m_buffer()
+    {
+
+    }
+
+    spsc_ringbuffer(const spsc_ringbuffer&) = delete;
+
+    spsc_ringbuffer& operator=(const spsc_ringbuffer&) = delete;
+
+    /**
+     * @brief Method for pushing value.
+     * May be called only by producer.
+     * @param value Value.
+     * @return False if there is no free space.
+     */
+    bool push(const value_type& value)
+    {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_cachedHead == Size)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+
+            if (tail - m_cachedHead == Size)
+            {
+                return false;
+            }
+        }
+
+        m_buffer[tail % Size] = value;
+
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for constructing value in place.
+     * May be called only by producer.
+     * @return False if there is no free space.
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args)
+    {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_cachedHead == Size)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+
+            if (tail - m_cachedHead == Size)
+            {
+                return false;
+            }
+        }
+
+        m_buffer[tail % Size] = value_type(std::forward<Args>(args)...);
+
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for reserving free slots, so values
+     * can be constructed in place and published with
+     * single index update by `commit`.
+     * May be called only by producer.
+     * @param count Number of slots.
+     * @return View of at most `count` free slots (less, if
+     * there is not enough free space).
+     */
+    ringbuffer_span<value_type> reserve(size_type count)
+    {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+
+        if (Size - (tail - m_cachedHead) < count)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+
+        auto available = Size - (tail - m_cachedHead);
+
+        if (count > available)
+        {
+            count = available;
+        }
+
+        auto position = tail % Size;
+        auto first = count < Size - position ? count : Size - position;
+
+        return ringbuffer_span<value_type>(m_buffer + position, first, m_buffer, count - first);
+    }
+
+    /**
+     * @brief Method for publishing values, that were
+     * constructed in slots returned by `reserve`.
+     * May be called only by producer.
+     * @param count Number of values.
+     */
+    void commit(size_type count)
+    {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+
+        if (Size - (tail - m_cachedHead) < count)
+        {
+            throw std::overflow_error("Not enough free space.");
+        }
+
+        m_tail.store(tail + count, std::memory_order_release);
+    }
+
+    /**
+     * @brief Method for getting oldest value without
+     * popping it. May be called only by consumer.
+     * @return Pointer to value or nullptr if
+     * ringbuffer is empty.
+     */
+    value_type* front()
+    {
+        auto head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+            if (head == m_cachedTail)
+            {
+                return nullptr;
+            }
+        }
+
+        return &m_buffer[head % Size];
+    }
+
+    /**
+     * @brief Method for popping value, returned by `front`.
+     * May be called only by consumer.
+     */
+    void pop_front()
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Method for popping value.
+     * May be called only by consumer.
+     * @param value Popped value.
+     * @return False if ringbuffer is empty.
+     */
+    bool pop(value_type& value)
+    {
+        auto* current = front();
+
+        if (current == nullptr)
+        {
+            return false;
+        }
+
+        value = std::move(*current);
+        pop_front();
+
+        return true;
+    }
+
+    /**
+     * @brief Method for consuming batch of values with
+     * single index update. May be called only by consumer.
+     * @tparam Function Callable with `void(value_type&)` signature.
+     * @param function Function.
+     * @param limit Maximum number of values.
+     * @return Number of consumed values.
+     */
+    template<typename Function>
+    size_type consume(Function function, size_type limit = Size)
+    {
+        auto head = m_head.load(std::memory_order_relaxed);
+
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+        auto count = m_cachedTail - head;
+
+        if (count > limit)
+        {
+            count = limit;
+        }
+
+        for (size_type i = 0; i < count; ++i)
+        {
+            function(m_buffer[(head + i) % Size]);
+        }
+
+        m_head.store(head + count, std::memory_order_release);
+
+        return count;
+    }
+
+    /**
+     * @brief Method for getting approximate number of values.
+     */
+    size_type size() const
+    {
+        auto head = m_head.load(std::memory_order_acquire);
+        auto tail = m_tail.load(std::memory_order_acquire);
+
+        return tail >= head ? tail - head : 0;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    size_type max_size() const
+    {
+        return Size;
+    }
+
+private:
+    // Producer side
+    alignas(64) std::atomic<size_type> m_tail;
+    size_type m_cachedHead;
+
+    // Consumer side
+    alignas(64) std::atomic<size_type> m_head;
+    size_type m_cachedTail;
+
+    alignas(64) value_type m_buffer[Size];
+};
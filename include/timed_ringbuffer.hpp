@@ -0,0 +1,518 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "ringbuffer.hpp"
+#include "ringbuffer_bits.hpp"
+
+/**
+ * @brief Clock, that returns steady_clock time
+ * in nanoseconds.
+ */
+struct ringbuffer_steady_clock
+{
+    static std::uint64_t now()
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()
+            ).count()
+        );
+    }
+};
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+/**
+ * @brief Clock, that returns raw time stamp counter.
+ * It's cheaper than steady_clock, but values are in
+ * cycles and depend on invariant TSC support.
+ */
+struct ringbuffer_tsc_clock
+{
+    static std::uint64_t now()
+    {
+        return __rdtsc();
+    }
+};
+#endif
+
+/**
+ * @brief Class, that describes lock-free histogram of
+ * durations with log-linear buckets. Every power of two
+ * range is split into 8 buckets, so relative error of
+ * percentiles is below 12.5%. Values are recorded by
+ * one or more threads and may be read concurrently.
+ */
+class dwell_time_histogram
+{
+public:
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Number of sub buckets for every power of two
+     * is 2 ^ SubBucketBits.
+     */
+    static constexpr unsigned SubBucketBits = 3;
+
+    static constexpr size_type SubBucketCount = size_type(1) << SubBucketBits;
+
+    static constexpr size_type BucketCount = SubBucketCount * (64 - SubBucketBits + 1);
+
+    dwell_time_histogram() :
+        m_sum(0),
+        m_max(0)
+    {
+        reset();
+    }
+
+    dwell_time_histogram(const dwell_time_histogram&) = delete;
+
+    dwell_time_histogram& operator=(const dwell_time_histogram&) = delete;
+
+    /**
+     * @brief Method for recording duration.
+     * @param value Duration in clock units.
+     */
+    void record(std::uint64_t value)
+    {
+        m_buckets[bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        auto current = m_max.load(std::memory_order_relaxed);
+
+        while (current < value &&
+               !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+
+        }
+    }
+
+    /**
+     * @brief Method for getting number of recorded durations.
+     * Buckets are summed, so recording stays cheap.
+     */
+    std::uint64_t count() const
+    {
+        std::uint64_t result = 0;
+
+        for (auto&& bucket : m_buckets)
+        {
+            result += bucket.load(std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Method for getting maximum recorded duration.
+     */
+    std::uint64_t max() const
+    {
+        return m_max.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Method for getting mean duration.
+     */
+    double mean() const
+    {
+        auto total = count();
+
+        return total == 0 ? 0.0 : static_cast<double>(m_sum.load(std::memory_order_relaxed)) / total;
+    }
+
+    /**
+     * @brief Method for getting percentile of recorded
+     * durations.
+     * @param fraction Percentile in [0, 1] range (0.99 for p99).
+     * @return Upper bound of bucket, that contains percentile,
+     * but not more than maximum recorded duration.
+     */
+    std::uint64_t percentile(double fraction) const
+    {
+        auto total = count();
+
+        if (total == 0)
+        {
+            return 0;
+        }
+
+        auto rank = static_cast<std::uint64_t>(fraction * total + 0.5);
+
+        if (rank < 1)
+        {
+            rank = 1;
+        }
+
+        std::uint64_t seen = 0;
+
+        for (size_type bucket = 0; bucket < BucketCount; ++bucket)
+        {
+            seen += m_buckets[bucket].load(std::memory_order_relaxed);
+
+            if (seen >= rank)
+            {
+                return std::min(upper_bound(bucket), max());
+            }
+        }
+
+        return max();
+    }
+
+    /**
+     * @brief Method for getting number of durations
+     * in bucket.
+     * @param bucket Bucket index.
+     */
+    std::uint64_t bucket_count(size_type bucket) const
+    {
+        if (bucket >= BucketCount)
+        {
+            throw std::out_of_range("Index is out of range.");
+        }
+
+        return m_buckets[bucket].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Method for getting bucket index of duration.
+     * @param value Duration.
+     */
+    static size_type bucket_of(std::uint64_t value)
+    {
+        if (value < SubBucketCount)
+        {
+            return static_cast<size_type>(value);
+        }
+
+        auto exponent = ringbuffer_detail::bit_width(value) - 1;
+        auto mantissa = (value >> (exponent - SubBucketBits)) & (SubBucketCount - 1);
+
+        return SubBucketCount * (exponent - SubBucketBits + 1) + static_cast<size_type>(mantissa);
+    }
+
+    /**
+     * @brief Method for getting largest duration,
+     * that falls into bucket.
+     * @param bucket Bucket index.
+     */
+    static std::uint64_t upper_bound(size_type bucket)
+    {
+        if (bucket < SubBucketCount)
+        {
+            return bucket;
+        }
+
+        auto shift = static_cast<unsigned>(bucket / SubBucketCount - 1);
+        auto mantissa = static_cast<std::uint64_t>(SubBucketCount + bucket % SubBucketCount);
+
+        // Wraps to maximum value for the last bucket
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    /**
+     * @brief Method for clearing histogram. It's not atomic
+     * relatively to concurrent `record` calls.
+     */
+    void reset()
+    {
+        for (auto&& bucket : m_buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+
+        m_sum.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Method for exporting summary
+     * (count, mean, p50, p90, p99, p99.9, max).
+     * @param stream Output stream.
+     */
+    void write(std::ostream& stream) const
+    {
+        stream << "count=" << count()
+               << " mean=" << mean()
+               << " p50=" << percentile(0.5)
+               << " p90=" << percentile(0.9)
+               << " p99=" << percentile(0.99)
+               << " p999=" << percentile(0.999)
+               << " max=" << max();
+    }
+
+private:
+
+    std::atomic<std::uint64_t> m_buckets[BucketCount];
+    std::atomic<std::uint64_t> m_sum;
+    std::atomic<std::uint64_t> m_max;
+};
+
+inline std::ostream& operator<<(std::ostream& stream, const dwell_time_histogram& histogram)
+{
+    histogram.write(stream);
+
+    return stream;
+}
+
+/**
+ * @brief Class, that describes ringbuffer, that measures
+ * time elements spend inside of it (queuing delay).
+ * Timestamp is stored for every slot on push and elapsed
+ * time is recorded into histogram on pop. Elements, that
+ * are overwritten before being popped, are only counted.
+ * Tracing is opt-in: plain `ringbuffer` doesn't store
+ * timestamps and has no overhead.
+ * @tparam T Value type.
+ * @tparam Size Ringbuffer size.
+ * @tparam Clock Type with static `std::uint64_t now()` method.
+ */
+template<typename T, std::size_t Size, typename Clock = ringbuffer_steady_clock>
+class timed_ringbuffer
+{
+public:
+
+    using value_type = T;
+
+    using reference = T&;
+
+    using const_reference = const T&;
+
+    using size_type = std::size_t;
+
+    using iterator = typename ringbuffer<T, Size>::iterator;
+
+    using const_iterator = typename ringbuffer<T, Size>::const_iterator;
+
+    /**
+     * @brief Default constructor.
+     */
+    timed_ringbuffer() :
+        m_buffer(),
+        m_overwritten(0),
+        m_histogram()
+    {
+
+    }
+
+    /**
+     * @brief Method for pushing back element and
+     * stamping it with current time.
+     * If ringbuffer is full, front element is overwritten.
+     * @param value Value.
+     */
+    void push_back(const value_type& value)
+    {
+        stamp();
+
+        m_buffer.push_back(value);
+    }
+
+    /**
+     * @brief Method for pushing back element and
+     * stamping it with current time.
+     * If ringbuffer is full, front element is overwritten.
+     * @param value Value.
+     */
+    void push_back(value_type&& value)
+    {
+        stamp();
+
+        m_buffer.push_back(std::move(value));
+    }
+
+    /**
+     * @brief Method for constructing element at the end
+     * and stamping it with current time.
+     * @param args Constructor arguments.
+     */
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        stamp();
+
+        m_buffer.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Method for popping element from front and
+     * recording its dwell time.
+     */
+    void pop_front()
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        m_histogram.record(Clock::now() - m_stamps[m_buffer.slot_index(0)]);
+
+        m_buffer.pop_front();
+    }
+
+    /**
+     * @brief Method for popping several elements from front
+     * and recording their dwell times. Clock is read once.
+     * @param count Number of elements.
+     */
+    void pop_front(size_type count)
+    {
+        if (count > size())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        auto now = Clock::now();
+
+        for (size_type i = 0; i < count; ++i)
+        {
+            m_histogram.record(now - m_stamps[m_buffer.slot_index(i)]);
+        }
+
+        m_buffer.pop_front(count);
+    }
+
+    /**
+     * @brief Method for getting time, that front element
+     * already spent in ringbuffer.
+     * @return Duration in clock units.
+     */
+    std::uint64_t front_age() const
+    {
+        if (empty())
+        {
+            throw std::overflow_error("There is no elements.");
+        }
+
+        return Clock::now() - m_stamps[m_buffer.slot_index(0)];
+    }
+
+    /**
+     * @brief Method for getting dwell time histogram.
+     * Histogram may be read from other threads.
+     */
+    dwell_time_histogram& histogram()
+    {
+        return m_histogram;
+    }
+
+    const dwell_time_histogram& histogram() const
+    {
+        return m_histogram;
+    }
+
+    /**
+     * @brief Method for getting number of elements,
+     * that were overwritten without being popped.
+     */
+    std::uint64_t overwritten() const
+    {
+        return m_overwritten;
+    }
+
+    reference front()
+    {
+        return m_buffer.front();
+    }
+
+    const_reference front() const
+    {
+        return m_buffer.front();
+    }
+
+    reference back()
+    {
+        return m_buffer.back();
+    }
+
+    const_reference back() const
+    {
+        return m_buffer.back();
+    }
+
+    reference operator[](size_type n)
+    {
+        return m_buffer[n];
+    }
+
+    const_reference operator[](size_type n) const
+    {
+        return m_buffer[n];
+    }
+
+    iterator begin()
+    {
+        return m_buffer.begin();
+    }
+
+    const_iterator begin() const
+    {
+        return m_buffer.begin();
+    }
+
+    iterator end()
+    {
+        return m_buffer.end();
+    }
+
+    const_iterator end() const
+    {
+        return m_buffer.end();
+    }
+
+    size_type size() const
+    {
+        return m_buffer.size();
+    }
+
+    size_type max_size() const
+    {
+        return Size;
+    }
+
+    bool empty() const
+    {
+        return m_buffer.empty();
+    }
+
+    /**
+     * @brief Method for clearing container.
+     * Histogram is kept.
+     */
+    void clear()
+    {
+        m_buffer.clear();
+    }
+
+private:
+
+    void stamp()
+    {
+        // Stamps are indexed by ringbuffer slots, if it's
+        // full, slot of overwritten front element is reused
+        m_stamps[m_buffer.slot_index(m_buffer.size())] = Clock::now();
+
+        if (m_buffer.size() == Size)
+        {
+            ++m_overwritten;
+        }
+    }
+
+    ringbuffer<T, Size> m_buffer;
+    std::uint64_t m_stamps[Size];
+    std::uint64_t m_overwritten;
+    dwell_time_histogram m_histogram;
+};
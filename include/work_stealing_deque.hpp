@@ -0,0 +1,246 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Class, that describes Chase-Lev work stealing
+ * deque on circular storage.
+ * Owner thread pushes and pops at the bottom, other
+ * threads steal from the top. When storage is filled, it's
+ * replaced with one twice as large. Replaced storages are
+ * kept until deque destruction, because thieves may still
+ * read from them.
+ * Storage is separate from `ringbuffer` one: thieves read
+ * slots concurrently with owner writes, so slots must be
+ * atomic, capacity must grow instead of being fixed
+ * `Size`, and indices are unbounded 64-bit counters
+ * masked by power of two capacity (`ringbuffer` index
+ * helpers keep wrapped positions).
+ * Memory orderings follow "Correct and Efficient
+ * Work-Stealing for Weak Memory Models" (Le et al.).
+ * @tparam T Value type. Must be trivially copyable,
+ * because thieves read it before claiming.
+ */
+template<typename T>
+class work_stealing_deque
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Work stealing deque requires trivially copyable type.");
+
+    class storage
+    {
+    public:
+        explicit storage(std::int64_t capacity) :
+            m_capacity(capacity),
+            m_mask(capacity - 1),
+            m_buffer(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+        {
+
+        }
+
+        std::int64_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        void put(std::int64_t index, const T& value)
+        {
+            m_buffer[index & m_mask].store(value, std::memory_order_relaxed);
+        }
+
+        T get(std::int64_t index) const
+        {
+            return m_buffer[index & m_mask].load(std::memory_order_relaxed);
+        }
+
+        storage* grow(std::int64_t bottom, std::int64_t top) const
+        {
+            auto* result = new storage(m_capacity * 2);
+
+            for (auto i = top; i != bottom; ++i)
+            {
+                result->put(i, get(i));
+            }
+
+            return result;
+        }
+
+    private:
+        std::int64_t m_capacity;
+        std::int64_t m_mask;
+        std::unique_ptr<std::atomic<T>[]> m_buffer;
+    };
+
+public:
+
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructor.
+     * @param capacity Initial capacity. Rounded up
+     * to power of 2.
+     */
+    explicit work_stealing_deque(size_type capacity = 1024) :
+        m_top(0),
+        m_bottom(0),
+        m_storage(nullptr),
+        m_retired()
+    {
+        std::int64_t rounded = 1;
+
+        while (rounded < static_cast<std::int64_t>(capacity))
+        {
+            rounded <<= 1;
+        }
+
+        m_storage.store(new storage(rounded), std::memory_order_relaxed);
+    }
+
+    work_stealing_deque(const work_stealing_deque&) = delete;
+
+    work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+    ~work_stealing_deque()
+    {
+        delete m_storage.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Method for pushing value to the bottom.
+     * May be called only by owner thread.
+     * @param value Value.
+     */
+    void push(const value_type& value)
+    {
+        auto bottom = m_bottom.load(std::memory_order_relaxed);
+        auto top = m_top.load(std::memory_order_acquire);
+        auto* current = m_storage.load(std::memory_order_relaxed);
+
+        if (bottom - top > current->capacity() - 1)
+        {
+            auto* grown = current->grow(bottom, top);
+
+            m_retired.emplace_back(current);
+            m_storage.store(grown, std::memory_order_release);
+
+            current = grown;
+        }
+
+        current->put(bottom, value);
+
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Method for popping value from the bottom.
+     * May be called only by owner thread.
+     * @param value Popped value.
+     * @return True if value was popped, false if
+     * deque is empty.
+     */
+    bool pop(value_type& value)
+    {
+        auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        auto* current = m_storage.load(std::memory_order_relaxed);
+
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        value = current->get(bottom);
+
+        if (top == bottom)
+        {
+            // Last element, racing with thieves
+            auto won = m_top.compare_exchange_strong(
+                top,
+                top + 1,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed
+            );
+
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            return won;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Method for stealing value from the top.
+     * May be called by any thread.
+     * @param value Stolen value.
+     * @return True if value was stolen, false if deque
+     * is empty or other thread claimed this value first.
+     */
+    bool steal(value_type& value)
+    {
+        auto top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return false;
+        }
+
+        auto* current = m_storage.load(std::memory_order_acquire);
+
+        value = current->get(top);
+
+        return m_top.compare_exchange_strong(
+            top,
+            top + 1,
+            std::memory_order_seq_cst,
+            std::memory_order_relaxed
+        );
+    }
+
+    /**
+     * @brief Method for getting approximate number
+     * of elements.
+     */
+    size_type size() const
+    {
+        auto bottom = m_bottom.load(std::memory_order_relaxed);
+        auto top = m_top.load(std::memory_order_relaxed);
+
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Method for getting current storage capacity.
+     * May be called only by owner thread.
+     */
+    size_type capacity() const
+    {
+        return static_cast<size_type>(m_storage.load(std::memory_order_relaxed)->capacity());
+    }
+
+private:
+    alignas(64) std::atomic<std::int64_t> m_top;
+    alignas(64) std::atomic<std::int64_t> m_bottom;
+    alignas(64) std::atomic<storage*> m_storage;
+    std::vector<std::unique_ptr<storage>> m_retired;
+};
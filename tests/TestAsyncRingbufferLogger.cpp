@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <async_ringbuffer_logger.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct LogRecord
+{
+    int thread;
+    int sequence;
+};
+
+struct LogFormatter
+{
+    void operator()(const LogRecord& record, std::string& output) const
+    {
+        output += std::to_string(record.thread);
+        output += ':';
+        output += std::to_string(record.sequence);
+        output += '\n';
+    }
+};
+
+struct StringSink
+{
+    void operator()(const char* data, std::size_t size) const
+    {
+        output->append(data, size);
+        ++*writes;
+    }
+
+    std::string* output;
+    std::atomic<int>* writes;
+};
+
+static std::vector<std::string> split_lines(const std::string& text)
+{
+    std::vector<std::string> result;
+    std::string::size_type begin = 0;
+
+    while (begin < text.size())
+    {
+        auto end = text.find('\n', begin);
+        result.push_back(text.substr(begin, end - begin));
+        begin = end + 1;
+    }
+
+    return result;
+}
+
+TEST(AsyncRingbufferLogger, FlushAndShutdown)
+{
+    std::string output;
+    std::atomic<int> writes(0);
+
+    ringbuffer_logger_options options;
+    options.flush_interval = std::chrono::milliseconds(10000);
+
+    auto logger = make_async_ringbuffer_logger<LogRecord, 64>(
+        LogFormatter(), StringSink{&output, &writes}, options
+    );
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(logger->log(LogRecord{0, i}));
+    }
+
+    logger->flush();
+
+    ASSERT_EQ(split_lines(output).size(), 10);
+    ASSERT_EQ(split_lines(output).back(), "0:9");
+
+    ASSERT_TRUE(logger->log(LogRecord{0, 10}));
+
+    logger->shutdown();
+
+    ASSERT_EQ(split_lines(output).size(), 11);
+    ASSERT_FALSE(logger->log(LogRecord{0, 11}));
+    ASSERT_EQ(logger->dropped(), 1);
+}
+
+TEST(AsyncRingbufferLogger, BlockingProducers)
+{
+    constexpr int Threads = 4;
+    constexpr int Count = 5000;
+
+    std::string output;
+    std::atomic<int> writes(0);
+
+    ringbuffer_logger_options options;
+    options.overflow = ringbuffer_overflow_policy::block;
+    options.flush_size = 4096;
+    options.batch_size = 16;
+
+    {
+        async_ringbuffer_logger<LogRecord, 32, LogFormatter, StringSink> logger(
+            LogFormatter(), StringSink{&output, &writes}, options
+        );
+
+        std::vector<std::thread> producers;
+
+        for (int thread = 0; thread < Threads; ++thread)
+        {
+            producers.emplace_back([&logger, thread]()
+            {
+                for (int i = 0; i < Count; ++i)
+                {
+                    logger.log(LogRecord{thread, i});
+                }
+            });
+        }
+
+        for (auto&& producer : producers)
+        {
+            producer.join();
+        }
+
+        ASSERT_EQ(logger.dropped(), 0);
+    }
+
+    auto lines = split_lines(output);
+
+    ASSERT_EQ(lines.size(), Threads * Count);
+
+    // Writes are batched
+    ASSERT_LT(writes.load(), Threads * Count / 10);
+
+    std::vector<int> expected(Threads, 0);
+
+    for (auto&& line : lines)
+    {
+        auto thread = std::stoi(line.substr(0, line.find(':')));
+        auto sequence = std::stoi(line.substr(line.find(':') + 1));
+
+        ASSERT_EQ(sequence, expected[thread]++);
+    }
+}
+
+struct SlowSink
+{
+    void operator()(const char* data, std::size_t size) const
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        output->append(data, size);
+    }
+
+    std::string* output;
+};
+
+TEST(AsyncRingbufferLogger, OverflowPolicies)
+{
+    for (auto policy : {ringbuffer_overflow_policy::drop, ringbuffer_overflow_policy::overwrite})
+    {
+        std::string output;
+
+        ringbuffer_logger_options options;
+        options.overflow = policy;
+        options.flush_size = 1;
+
+        async_ringbuffer_logger<LogRecord, 4, LogFormatter, SlowSink> logger(
+            LogFormatter(), SlowSink{&output}, options
+        );
+
+        for (int i = 0; i < 100; ++i)
+        {
+            logger.log(LogRecord{0, i});
+        }
+
+        logger.shutdown();
+
+        auto lines = split_lines(output);
+        auto lost = policy == ringbuffer_overflow_policy::drop ? logger.dropped() : logger.overwritten();
+
+        ASSERT_GT(lost, 0);
+        ASSERT_EQ(lines.size() + lost, 100);
+
+        // Overwrite keeps the newest record, drop keeps the oldest
+        if (policy == ringbuffer_overflow_policy::overwrite)
+        {
+            ASSERT_EQ(lines.back(), "0:99");
+        }
+        else
+        {
+            ASSERT_EQ(lines.front(), "0:0");
+        }
+    }
+}
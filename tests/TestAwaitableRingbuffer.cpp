@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <awaitable_ringbuffer.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <atomic>
+#include <chrono>
+
+static ringbuffer_detached_task produce(awaitable_ringbuffer<int, 4>& queue,
+                                        ringbuffer_executor& executor,
+                                        int from,
+                                        int count)
+{
+    co_await executor.schedule();
+
+    for (int i = from; i < from + count; ++i)
+    {
+        co_await queue.push(i, executor);
+    }
+}
+
+static ringbuffer_detached_task consume(awaitable_ringbuffer<int, 4>& queue,
+                                        ringbuffer_executor& executor,
+                                        int count,
+                                        std::vector<int>& result,
+                                        std::atomic<int>& done)
+{
+    co_await executor.schedule();
+
+    for (int i = 0; i < count; ++i)
+    {
+        result.push_back(co_await queue.pop(executor));
+    }
+
+    ++done;
+}
+
+TEST(AwaitableRingbuffer, SingleThreadOrder)
+{
+    ringbuffer_single_thread_executor executor;
+    awaitable_ringbuffer<int, 4> queue;
+
+    std::vector<int> result;
+    std::atomic<int> done(0);
+
+    // Consumer starts first and suspends on empty queue
+    consume(queue, executor, 100, result, done);
+    produce(queue, executor, 0, 100);
+
+    executor.run();
+
+    ASSERT_EQ(done, 1);
+    ASSERT_EQ(result.size(), 100);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(result[i], i);
+    }
+
+    ASSERT_EQ(queue.size(), 0);
+}
+
+TEST(AwaitableRingbuffer, ProducerSuspendsWhenFull)
+{
+    ringbuffer_single_thread_executor executor;
+    awaitable_ringbuffer<int, 4> queue;
+
+    produce(queue, executor, 0, 10);
+
+    executor.run();
+
+    ASSERT_EQ(queue.size(), 4);
+
+    std::vector<int> result;
+    std::atomic<int> done(0);
+
+    consume(queue, executor, 10, result, done);
+
+    executor.run();
+
+    ASSERT_EQ(done, 1);
+    ASSERT_EQ(result.back(), 9);
+}
+
+TEST(AwaitableRingbuffer, ThreadPool)
+{
+    constexpr int Count = 10000;
+
+    awaitable_ringbuffer<int, 4> queue;
+
+    std::vector<int> first;
+    std::vector<int> second;
+    std::atomic<int> done(0);
+
+    {
+        ringbuffer_thread_pool pool(4);
+
+        produce(queue, pool, 0, Count);
+        produce(queue, pool, Count, Count);
+        consume(queue, pool, Count, first, done);
+        consume(queue, pool, Count, second, done);
+
+        while (done != 2)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::vector<int> all(first);
+    all.insert(all.end(), second.begin(), second.end());
+    std::sort(all.begin(), all.end());
+
+    ASSERT_EQ(all.size(), 2 * Count);
+
+    for (int i = 0; i < 2 * Count; ++i)
+    {
+        ASSERT_EQ(all[i], i);
+    }
+}
+
+#endif
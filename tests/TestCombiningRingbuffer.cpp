@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <combining_ringbuffer.hpp>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST(CombiningRingbuffer, PushDrain)
+{
+    combining_ringbuffer<int, 4> buffer;
+
+    for (int i = 0; i < 6; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    ASSERT_EQ(buffer.size(), 4);
+    ASSERT_EQ(buffer.overwritten(), 2);
+    ASSERT_EQ(buffer.combines(), 7);
+
+    int value = -1;
+
+    ASSERT_TRUE(buffer.try_pop(value));
+    ASSERT_EQ(value, 2);
+
+    std::vector<int> values;
+
+    ASSERT_EQ(buffer.drain([&values](int el) { values.push_back(el); }, 2), 2);
+    ASSERT_EQ(values, std::vector<int>({3, 4}));
+
+    ASSERT_EQ(buffer.drain([&values](int el) { values.push_back(el); }), 1);
+    ASSERT_EQ(values.back(), 5);
+
+    ASSERT_FALSE(buffer.try_pop(value));
+}
+
+TEST(CombiningRingbuffer, ConcurrentProducers)
+{
+    const uint32_t producers = 4;
+    const uint32_t perProducer = 20000;
+
+    combining_ringbuffer<uint64_t, producers * perProducer> buffer;
+
+    std::atomic<bool> running(true);
+    std::vector<uint32_t> next(producers, 0);
+    uint64_t received = 0;
+    bool ordered = true;
+
+    std::thread consumer([&]()
+    {
+        auto take = [&](uint64_t el)
+        {
+            auto producer = static_cast<uint32_t>(el >> 32);
+            auto sequence = static_cast<uint32_t>(el);
+
+            ordered = ordered && next[producer] == sequence;
+            next[producer] = sequence + 1;
+            ++received;
+        };
+
+        while (running.load())
+        {
+            if (buffer.drain(take, 256) == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        buffer.drain(take);
+    });
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&buffer, p, perProducer]()
+        {
+            for (uint32_t i = 0; i < perProducer; ++i)
+            {
+                buffer.push_back((static_cast<uint64_t>(p) << 32) | i);
+            }
+        });
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    running = false;
+    consumer.join();
+
+    ASSERT_TRUE(ordered);
+    ASSERT_EQ(received, producers * perProducer);
+    ASSERT_EQ(buffer.overwritten(), 0);
+}
+
+struct counted_registry_entry
+{
+    counted_registry_entry() :
+        claimed(true)
+    {
+        ++alive;
+    }
+
+    ~counted_registry_entry()
+    {
+        --alive;
+    }
+
+    std::atomic<bool> claimed;
+
+    static int alive;
+};
+
+int counted_registry_entry::alive = 0;
+
+TEST(CombiningRingbuffer, ShortLivedRegistries)
+{
+    // Thread local references to destroyed registries
+    // must not accumulate in long living thread
+    for (int i = 0; i < 100; ++i)
+    {
+        ringbuffer_detail::thread_registry<counted_registry_entry> registry;
+
+        registry.local();
+        registry.local();
+
+        ASSERT_EQ(registry.size(), 1);
+    }
+
+    ASSERT_LE(counted_registry_entry::alive, 1);
+}
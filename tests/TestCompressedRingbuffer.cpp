@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <compressed_ringbuffer.hpp>
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+TEST(CompressedRingbuffer, KeepsWindowOfCounters)
+{
+    compressed_ringbuffer<uint64_t, 4, 16> buffer;
+    std::deque<uint64_t> reference;
+
+    uint64_t counter = 1000;
+
+    for (int i = 0; i < 300; ++i)
+    {
+        counter += static_cast<uint64_t>(i % 7);
+
+        buffer.push_back(counter);
+        reference.push_back(counter);
+    }
+
+    // 300 = 18 full blocks + 12 values in open block
+    while (reference.size() > buffer.size())
+    {
+        reference.pop_front();
+    }
+
+    ASSERT_EQ(buffer.size(), 4 * 16 + 12);
+    ASSERT_EQ(buffer.front(), reference.front());
+    ASSERT_EQ(buffer.back(), reference.back());
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), reference.begin()));
+
+    std::vector<uint64_t> traversed;
+    buffer.for_each([&traversed](uint64_t value) { traversed.push_back(value); });
+
+    ASSERT_TRUE(std::equal(traversed.begin(), traversed.end(), reference.begin()));
+}
+
+TEST(CompressedRingbuffer, SignedAndWrappingDeltas)
+{
+    compressed_ringbuffer<int32_t, 2, 8> buffer;
+    std::vector<int32_t> source = {
+        0, -1, 1, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(),
+        5, 5, 5, -100, 100, 0, 0, 0, 0, 0, 1
+    };
+
+    for (auto&& value : source)
+    {
+        buffer.push_back(value);
+    }
+
+    ASSERT_EQ(buffer.block_count(), 2);
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), source.begin()));
+    ASSERT_EQ(buffer.back(), 1);
+}
+
+TEST(CompressedRingbuffer, FloatingPointRoundTrip)
+{
+    compressed_ringbuffer<double, 3, 32> buffer;
+    std::vector<double> source;
+
+    for (int i = 0; i < 96 + 5; ++i)
+    {
+        source.push_back(20.5 + (i % 3) * 0.25);
+        buffer.push_back(source.back());
+    }
+
+    ASSERT_EQ(buffer.size(), source.size());
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), source.begin()));
+}
+
+TEST(CompressedRingbuffer, PopFrontBlock)
+{
+    compressed_ringbuffer<uint32_t, 2, 4> buffer;
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    ASSERT_EQ(buffer.front(), 0);
+
+    buffer.pop_front_block();
+    ASSERT_EQ(buffer.front(), 4);
+
+    buffer.pop_front_block();
+    ASSERT_EQ(buffer.front(), 8);
+    ASSERT_EQ(buffer.size(), 2);
+
+    buffer.pop_front_block();
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_TRUE(buffer.begin() == buffer.end());
+    ASSERT_THROW(buffer.pop_front_block(), std::overflow_error);
+    ASSERT_THROW(buffer.front(), std::overflow_error);
+    ASSERT_THROW(buffer.back(), std::overflow_error);
+}
+
+TEST(CompressedRingbuffer, EmptyAccess)
+{
+    compressed_ringbuffer<uint32_t, 2, 4> buffer;
+
+    ASSERT_THROW(buffer.front(), std::overflow_error);
+    ASSERT_THROW(buffer.back(), std::overflow_error);
+
+    buffer.push_back(5);
+
+    ASSERT_EQ(buffer.front(), 5);
+    ASSERT_EQ(buffer.back(), 5);
+}
+
+TEST(CompressedRingbuffer, MemoryReduction)
+{
+    constexpr std::size_t Blocks = 64;
+    constexpr std::size_t BlockSize = 128;
+
+    compressed_ringbuffer<uint64_t, Blocks, BlockSize> buffer;
+
+    // Timestamps with ~1ms period and jitter
+    uint64_t timestamp = 1500000000000000ull;
+
+    for (std::size_t i = 0; i < Blocks * BlockSize; ++i)
+    {
+        timestamp += 1000 + (i * 7919) % 13;
+        buffer.push_back(timestamp);
+    }
+
+    auto raw = Blocks * BlockSize * sizeof(uint64_t);
+
+    ASSERT_LT(buffer.memory_usage() * 4, raw);
+}
+
+TEST(CompressedRingbuffer, FloatingPointMemoryReduction)
+{
+    constexpr std::size_t Blocks = 64;
+    constexpr std::size_t BlockSize = 128;
+
+    compressed_ringbuffer<double, Blocks, BlockSize> buffer;
+    std::vector<double> source;
+
+    // Sensor readings with 1/8 resolution: residuals
+    // have only few meaningful mantissa bits
+    for (std::size_t i = 0; i < Blocks * BlockSize; ++i)
+    {
+        source.push_back(20.0 + static_cast<double>((i * 7919) % 29) * 0.125);
+        buffer.push_back(source.back());
+    }
+
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), source.begin()));
+
+    auto raw = Blocks * BlockSize * sizeof(double);
+
+    ASSERT_LT(buffer.memory_usage() * 4, raw);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <ringbuffer.hpp>
+#include <vector>
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201907L
+
+// Window, that is built by overwriting and popping
+constexpr ringbuffer<int, 4> make_window()
+{
+    ringbuffer<int, 4> window;
+
+    for (int i = 0; i < 7; ++i)
+    {
+        window.push_back(i);
+    }
+
+    window.pop_front();
+
+    return window;
+}
+
+// Moving average of sequence with window of 3 taps
+constexpr ringbuffer<int, 8> make_averages()
+{
+    ringbuffer<int, 3> taps;
+    ringbuffer<int, 8> result;
+
+    for (int i = 1; i <= 10; ++i)
+    {
+        taps.push_back(i * 3);
+
+        int sum = 0;
+
+        for (auto el : taps)
+        {
+            sum += el;
+        }
+
+        result.push_back(sum / static_cast<int>(taps.size()));
+    }
+
+    return result;
+}
+
+constexpr int sum(const ringbuffer<int, 4>& buffer)
+{
+    int result = 0;
+
+    for (auto it = buffer.begin(); it != buffer.end(); ++it)
+    {
+        result += *it;
+    }
+
+    return result;
+}
+
+constexpr auto window = make_window();
+constexpr auto averages = make_averages();
+
+static_assert(window.size() == 3, "Constexpr size");
+static_assert(window.front() == 4 && window.back() == 6, "Constexpr front and back");
+static_assert(window[1] == 5 && window.at(2) == 6, "Constexpr element access");
+static_assert(sum(window) == 15, "Constexpr iteration");
+
+static_assert(averages.size() == 8 && averages.front() == 6 && averages.back() == 27, "Constexpr table");
+
+static_assert(ringbuffer<int, 3>({1, 2, 3}).back() == 3, "Constexpr initializer list");
+static_assert(ringbuffer<int, 3>(std::size_t(2), 7)[1] == 7, "Constexpr fill");
+
+static_assert([]()
+{
+    ringbuffer<int, 4> buffer;
+
+    buffer.push_front(1);
+    buffer.push_front(2);
+    buffer.push_back(3);
+    buffer.pop_front(2);
+
+    return buffer.size() == 1 && buffer.front() == 3 && buffer.rbegin() != buffer.rend();
+}(), "Constexpr push front and pop");
+
+TEST(ConstexprRingbuffer, MatchesRuntime)
+{
+    ringbuffer<int, 4> runtime;
+
+    for (int i = 0; i < 7; ++i)
+    {
+        runtime.push_back(i);
+    }
+
+    runtime.pop_front();
+
+    ASSERT_EQ(std::vector<int>(window.begin(), window.end()), std::vector<int>(runtime.begin(), runtime.end()));
+    ASSERT_EQ(averages[2], (9 + 12 + 15) / 3);
+}
+
+#endif
@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 #include <ringbuffer.hpp>
+#include <set>
+#include <vector>
 
 constexpr std::size_t Size = 14;
 
@@ -36,4 +38,152 @@ TEST(ElementAccess, Total)
     }
 
     ASSERT_THROW(rb.pop_front(), std::overflow_error);
-}
\ No newline at end of file
+}
+
+TEST(ElementAccess, Segments)
+{
+    ringbuffer<uint32_t, Size> rb;
+
+    ASSERT_EQ(rb.first_segment().size, 0);
+    ASSERT_EQ(rb.first_free_segment().size, Size);
+
+    for (auto&& el : dataSource)
+    {
+        rb.push_back(el);
+    }
+
+    rb.pop_front(10);
+    rb.push_back(15);
+    rb.push_back(16);
+
+    // Elements: 11 12 13 14 | 15 16
+    auto first = rb.first_segment();
+    auto second = rb.second_segment();
+
+    ASSERT_EQ(first.size, 4);
+    ASSERT_EQ(first.data[0], 11);
+    ASSERT_EQ(second.size, 2);
+    ASSERT_EQ(second.data[1], 16);
+
+    // Free space is between 16 and 11
+    ASSERT_EQ(rb.first_free_segment().size, Size - 6);
+    ASSERT_EQ(rb.second_free_segment().size, 0);
+
+    auto free = rb.first_free_segment();
+    free.data[0] = 17;
+    free.data[1] = 18;
+
+    rb.commit(2);
+
+    ASSERT_EQ(rb.size(), 8);
+    ASSERT_EQ(rb.back(), 18);
+    ASSERT_THROW(rb.commit(Size), std::overflow_error);
+}
+
+TEST(ElementAccess, ReserveCommit)
+{
+    ringbuffer<uint32_t, Size> rb;
+
+    rb.push_back(0);
+    rb.pop_front();
+
+    // Reserved slots wrap around storage end
+    auto slots = rb.reserve(Size);
+
+    ASSERT_EQ(slots.size(), Size);
+    ASSERT_EQ(slots.first_segment().size, Size - 1);
+    ASSERT_EQ(slots.second_segment().size, 1);
+
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        slots[i] = i + 1;
+    }
+
+    rb.commit(5);
+
+    ASSERT_EQ(rb.size(), 5);
+    ASSERT_EQ(rb.back(), 5);
+
+    ASSERT_EQ(rb.reserve(100).size(), Size - 5);
+    ASSERT_EQ(rb.reserve(3).size(), 3);
+}
+
+TEST(ElementAccess, RecycleSlots)
+{
+    ringbuffer<std::vector<uint8_t>, 4> rb;
+
+    // Warming up slots
+    for (int i = 0; i < 4; ++i)
+    {
+        rb.acquire_back().reserve(64);
+        rb.publish_back();
+    }
+
+    rb.clear();
+
+    std::vector<uint8_t> taken;
+    taken.reserve(64);
+
+    std::set<const uint8_t*> storages;
+
+    for (auto&& slot : rb.reserve(4))
+    {
+        storages.insert(slot.data());
+    }
+
+    storages.insert(taken.data());
+
+    for (uint8_t i = 0; i < 50; ++i)
+    {
+        rb.refill_back([i](std::vector<uint8_t>& slot) { slot.assign(1 + i % 60, i); });
+
+        if (i % 3 != 0)
+        {
+            rb.take_front(taken);
+
+            ASSERT_FALSE(taken.empty());
+            ASSERT_TRUE(storages.count(taken.data()));
+        }
+    }
+
+    // Pushes outpace pops, so overwritten slots are refilled too
+    ASSERT_EQ(rb.size(), 3);
+    ASSERT_EQ(rb.back(), std::vector<uint8_t>(1 + 49 % 60, 49));
+
+    for (auto&& el : rb)
+    {
+        ASSERT_TRUE(storages.count(el.data()));
+    }
+
+    rb.clear();
+
+    ASSERT_THROW(rb.take_front(taken), std::overflow_error);
+}
+
+TEST(ElementAccess, SlotIndex)
+{
+    ringbuffer<uint32_t, 5> rb;
+
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        rb.push_back(i);
+    }
+
+    // Begin is at slot 3
+    ASSERT_EQ(rb.slot_index(0), 3);
+    ASSERT_EQ(rb.slot_index(2), 0);
+    ASSERT_EQ(rb.slot_index(rb.size()), 3);
+
+    for (std::size_t i = 0; i < rb.size(); ++i)
+    {
+        ASSERT_EQ(rb.element_index(rb.slot_index(i)), i);
+    }
+
+    // Slot of element is kept, while front is popped
+    auto slot = rb.slot_index(4);
+
+    rb.pop_front();
+
+    ASSERT_EQ(rb.slot_index(3), slot);
+    ASSERT_EQ(rb[rb.element_index(slot)], 7);
+}
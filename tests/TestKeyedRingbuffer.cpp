@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <keyed_ringbuffer.hpp>
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <string>
+
+TEST(KeyedRingbuffer, DedupWindow)
+{
+    keyed_ringbuffer<uint64_t, 128> buffer;
+    std::deque<uint64_t> window;
+
+    std::mt19937_64 random(7);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        // Small key space, so there are duplicates and probe clusters
+        auto key = random() % 512;
+
+        buffer.push_back(key);
+        window.push_back(key);
+
+        if (window.size() > 128)
+        {
+            window.pop_front();
+        }
+
+        if (i % 3 == 0)
+        {
+            buffer.pop_front();
+            window.pop_front();
+        }
+
+        auto probe = random() % 512;
+        auto expected = std::find(window.begin(), window.end(), probe) != window.end();
+
+        ASSERT_EQ(buffer.contains(probe), expected) << "Iteration " << i;
+    }
+
+    ASSERT_EQ(buffer.size(), window.size());
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), window.begin()));
+}
+
+struct Order
+{
+    uint32_t id;
+    std::string symbol;
+};
+
+struct OrderId
+{
+    uint32_t operator()(const Order& order) const
+    {
+        return order.id;
+    }
+};
+
+TEST(KeyedRingbuffer, KeyExtractor)
+{
+    keyed_ringbuffer<Order, 4, OrderId> buffer;
+
+    buffer.push_back({1, "AAPL"});
+    buffer.push_back({2, "MSFT"});
+    buffer.push_back({3, "GOOG"});
+
+    ASSERT_NE(buffer.find(2), nullptr);
+    ASSERT_EQ(buffer.find(2)->symbol, "MSFT");
+    ASSERT_EQ(buffer.find(4), nullptr);
+
+    buffer.push_back({4, "AMZN"});
+    buffer.push_back({5, "META"});
+
+    // First one was evicted
+    ASSERT_FALSE(buffer.contains(1));
+    ASSERT_TRUE(buffer.contains(5));
+    ASSERT_EQ(buffer.front().id, 2);
+
+    buffer.clear();
+
+    ASSERT_FALSE(buffer.contains(5));
+    ASSERT_THROW(buffer.pop_front(), std::overflow_error);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <ringbuffer.hpp>
+#include <string>
+#include <vector>
 
 TEST(Main, InifitePushBack)
 {
@@ -11,4 +13,227 @@ TEST(Main, InifitePushBack)
     }
 
     ASSERT_EQ(buffer.size(), 128);
-}
\ No newline at end of file
+}
+
+TEST(Main, OverwriteKeepsNewest)
+{
+    ringbuffer<uint32_t, 4> buffer;
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    ASSERT_EQ(buffer.front(), 6);
+    ASSERT_EQ(buffer.back(), 9);
+
+    uint32_t expected = 6;
+
+    for (auto&& el : buffer)
+    {
+        ASSERT_EQ(el, expected++);
+    }
+}
+
+TEST(Main, PushAfterFillConstructor)
+{
+    ringbuffer<uint32_t, 4> buffer(std::size_t(2), 7);
+
+    buffer.push_back(8);
+
+    ASSERT_EQ(buffer.size(), 3);
+    ASSERT_EQ(buffer.front(), 7);
+    ASSERT_EQ(buffer.back(), 8);
+}
+
+TEST(Main, CompactFootprint)
+{
+    // Two 1 byte counters and padding to alignment of uint32_t
+    ASSERT_EQ(sizeof(ringbuffer<uint32_t, 16>), 16 * sizeof(uint32_t) + sizeof(uint32_t));
+    ASSERT_EQ(sizeof(ringbuffer<uint8_t, 255>), 255 + 2);
+    ASSERT_EQ(sizeof(ringbuffer<uint8_t, 256>), 256 + 4);
+
+    ringbuffer<uint8_t, 255> buffer;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        buffer.push_back(static_cast<uint8_t>(i));
+    }
+
+    ASSERT_EQ(buffer.size(), 255);
+    ASSERT_EQ(buffer.front(), static_cast<uint8_t>(1000 - 255));
+    ASSERT_EQ(buffer.back(), static_cast<uint8_t>(999));
+
+    buffer.pop_front(200);
+    buffer.pop_back();
+
+    ASSERT_EQ(buffer.size(), 54);
+    ASSERT_EQ(buffer.back(), static_cast<uint8_t>(998));
+}
+
+TEST(Main, EraseRange)
+{
+    for (uint32_t from = 0; from <= 8; ++from)
+    {
+        for (uint32_t to = from; to <= 8; ++to)
+        {
+            ringbuffer<uint32_t, 8> buffer;
+            std::vector<uint32_t> expected;
+
+            // Elements are wrapped around storage end
+            for (uint32_t i = 0; i < 13; ++i)
+            {
+                buffer.push_back(i);
+            }
+
+            for (auto&& el : buffer)
+            {
+                expected.push_back(el);
+            }
+
+            auto result = buffer.erase(buffer.begin() + from, buffer.begin() + to);
+            expected.erase(expected.begin() + from, expected.begin() + to);
+
+            ASSERT_EQ(buffer.size(), expected.size());
+            ASSERT_EQ(std::vector<uint32_t>(buffer.begin(), buffer.end()), expected);
+            ASSERT_TRUE(result == buffer.begin() + from);
+        }
+    }
+}
+
+TEST(Main, EraseSingle)
+{
+    ringbuffer<uint32_t, 4> buffer;
+
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    buffer.erase(buffer.begin());
+    ASSERT_EQ(std::vector<uint32_t>(buffer.begin(), buffer.end()), std::vector<uint32_t>({3, 4, 5}));
+
+    buffer.erase(buffer.begin() + 1);
+    ASSERT_EQ(std::vector<uint32_t>(buffer.begin(), buffer.end()), std::vector<uint32_t>({3, 5}));
+
+    ASSERT_THROW(buffer.erase(buffer.begin() + 2), std::out_of_range);
+}
+
+TEST(Main, RemoveIf)
+{
+    ringbuffer<uint32_t, 16> buffer;
+
+    for (uint32_t i = 0; i < 26; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    ASSERT_EQ(buffer.remove_if([](uint32_t el) { return el % 3 == 0; }), 5);
+    ASSERT_EQ(std::vector<uint32_t>(buffer.begin(), buffer.end()),
+              std::vector<uint32_t>({10, 11, 13, 14, 16, 17, 19, 20, 22, 23, 25}));
+
+    ASSERT_EQ(erase_if(buffer, [](uint32_t el) { return el > 20; }), 3);
+    ASSERT_EQ(buffer.size(), 8);
+    ASSERT_EQ(buffer.back(), 20);
+
+    buffer.push_back(30);
+    ASSERT_EQ(buffer.back(), 30);
+    ASSERT_EQ(buffer.size(), 9);
+}
+
+TEST(Main, PushFront)
+{
+    ringbuffer<uint32_t, 4> buffer;
+
+    buffer.push_front(1);
+    buffer.push_back(2);
+    buffer.emplace_front(0u);
+
+    ASSERT_EQ(std::vector<uint32_t>(buffer.begin(), buffer.end()), std::vector<uint32_t>({0, 1, 2}));
+
+    buffer.push_front(10);
+    buffer.push_front(20);
+
+    // Back element was overwritten
+    ASSERT_EQ(buffer.size(), 4);
+    ASSERT_EQ(std::vector<uint32_t>(buffer.begin(), buffer.end()), std::vector<uint32_t>({20, 10, 0, 1}));
+    ASSERT_EQ(buffer.back(), 1);
+}
+
+template<typename T, typename Make>
+static void check_insert(Make make)
+{
+    for (std::size_t shift = 0; shift < 8; ++shift)
+    {
+        for (std::size_t length = 0; length <= 6; ++length)
+        {
+            for (std::size_t index = 0; index <= length; ++index)
+            {
+                ringbuffer<T, 8> buffer;
+                std::vector<T> expected;
+
+                for (std::size_t i = 0; i < shift; ++i)
+                {
+                    buffer.push_back(make(0));
+                    buffer.pop_front();
+                }
+
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    buffer.push_back(make(i));
+                    expected.push_back(make(i));
+                }
+
+                std::vector<T> values({make(100), make(101)});
+
+                auto result = buffer.insert(buffer.begin() + index, values.begin(), values.end());
+                expected.insert(expected.begin() + index, values.begin(), values.end());
+
+                ASSERT_EQ(std::vector<T>(buffer.begin(), buffer.end()), expected);
+                ASSERT_TRUE(*result == make(100));
+            }
+        }
+    }
+}
+
+TEST(Main, InsertRange)
+{
+    check_insert<uint32_t>([](std::size_t i) { return static_cast<uint32_t>(i); });
+    check_insert<std::string>([](std::size_t i) { return std::to_string(i); });
+
+    ringbuffer<uint32_t, 4> buffer({1, 2, 3});
+
+    buffer.insert(buffer.begin() + 1, 5);
+    ASSERT_EQ(std::vector<uint32_t>(buffer.begin(), buffer.end()), std::vector<uint32_t>({1, 5, 2, 3}));
+
+    ASSERT_THROW(buffer.insert(buffer.begin(), 6), std::overflow_error);
+}
+
+TEST(Main, InsertOwnElement)
+{
+    ringbuffer<std::string, 8> buffer({"a", "b", "c", "d"});
+
+    buffer.insert(buffer.begin() + 2, buffer[2]);
+    ASSERT_EQ(std::vector<std::string>(buffer.begin(), buffer.end()), std::vector<std::string>({"a", "b", "c", "c", "d"}));
+
+    buffer.insert(buffer.begin() + 1, buffer[0]);
+    ASSERT_EQ(std::vector<std::string>(buffer.begin(), buffer.end()), std::vector<std::string>({"a", "a", "b", "c", "c", "d"}));
+
+    buffer.insert(buffer.end(), buffer.back());
+    ASSERT_EQ(buffer.back(), "d");
+    ASSERT_EQ(buffer.size(), 7);
+}
+
+TEST(Main, InsertEmptyRange)
+{
+    ringbuffer<std::string, 8> buffer({"a", "b", "c"});
+    std::vector<std::string> empty;
+
+    for (std::size_t index = 0; index <= buffer.size(); ++index)
+    {
+        auto result = buffer.insert(buffer.begin() + index, empty.begin(), empty.end());
+
+        ASSERT_TRUE(result == buffer.begin() + index);
+        ASSERT_EQ(std::vector<std::string>(buffer.begin(), buffer.end()), std::vector<std::string>({"a", "b", "c"}));
+    }
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <ringbuffer.hpp>
+#include <mapped_ringbuffer.hpp>
+
+using LargeBuffer = ringbuffer<uint64_t, 1 << 20>;
+
+TEST(MappedRingbuffer, DefaultOptions)
+{
+    auto buffer = make_mapped_ringbuffer<LargeBuffer>(ringbuffer_mapping_options());
+
+    ASSERT_TRUE(buffer->empty());
+    ASSERT_GE(buffer.get_deleter().mapped_length(), sizeof(LargeBuffer));
+
+    for (uint64_t i = 0; i < (1 << 20) + 10; ++i)
+    {
+        buffer->push_back(i);
+    }
+
+    ASSERT_EQ(buffer->size(), 1 << 20);
+    ASSERT_EQ(buffer->front(), 10);
+    ASSERT_EQ(buffer->back(), (1 << 20) + 9);
+}
+
+TEST(MappedRingbuffer, HugePagesAndPrefault)
+{
+    ringbuffer_mapping_options options;
+    options.huge_pages = true;
+    options.prefault = true;
+    options.numa_node = 0;
+
+    auto buffer = make_mapped_ringbuffer<LargeBuffer>(options);
+
+    // Huge pages are rounded to 2M
+    ASSERT_EQ(buffer.get_deleter().mapped_length() % (2 * 1024 * 1024), 0);
+
+    // Also with transparent huge pages fallback
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.get()) % (2 * 1024 * 1024), 0);
+
+    buffer->push_back(42);
+
+    ASSERT_EQ(buffer->front(), 42);
+}
+
+TEST(MappedRingbuffer, ConstructorArguments)
+{
+    using SmallBuffer = ringbuffer<int, 16>;
+
+    auto buffer = make_mapped_ringbuffer<SmallBuffer>(ringbuffer_mapping_options(), std::size_t(4), 7);
+
+    ASSERT_EQ(buffer->size(), 4);
+    ASSERT_EQ((*buffer)[3], 7);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <multi_lane_ringbuffer.hpp>
+#include <stdexcept>
+#include <vector>
+
+TEST(MultiLaneRingbuffer, StrictPriority)
+{
+    multi_lane_ringbuffer<int, 8, 3> queue;
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.top_lane(), 3);
+
+    queue.push_back(2, 20);
+    queue.push_back(0, 1);
+    queue.push_back(1, 10);
+    queue.emplace_back(0, 2);
+    queue.push_back(2, 21);
+
+    ASSERT_EQ(queue.size(), 5);
+    ASSERT_EQ(queue.lane(2).size(), 2);
+    ASSERT_EQ(queue.top_lane(), 0);
+
+    int value = 0;
+
+    ASSERT_TRUE(queue.pop_front(value));
+    ASSERT_EQ(value, 1);
+
+    // Higher lane preempts lower one
+    queue.push_back(1, 11);
+
+    std::vector<int> values;
+    std::vector<std::size_t> lanes;
+
+    ASSERT_EQ(queue.drain([&](std::size_t lane, int el) { lanes.push_back(lane); values.push_back(el); }), 5);
+
+    ASSERT_EQ(values, std::vector<int>({2, 10, 11, 20, 21}));
+    ASSERT_EQ(lanes, std::vector<std::size_t>({0, 1, 1, 2, 2}));
+
+    ASSERT_FALSE(queue.pop_front(value));
+}
+
+TEST(MultiLaneRingbuffer, DeficitRoundRobin)
+{
+    multi_lane_ringbuffer<int, 16, 3> queue(ringbuffer_lane_policy::deficit_round_robin, {{3, 1, 2}});
+
+    for (int i = 0; i < 8; ++i)
+    {
+        queue.push_back(0, i);
+        queue.push_back(2, 200 + i);
+    }
+
+    queue.push_back(1, 100);
+
+    std::vector<std::size_t> lanes;
+
+    while (!queue.empty())
+    {
+        queue.drain([&lanes](std::size_t lane, int) { lanes.push_back(lane); }, 1);
+    }
+
+    ASSERT_EQ(lanes, std::vector<std::size_t>({
+        0, 0, 0, 1, 2, 2,
+        0, 0, 0, 2, 2,
+        0, 0, 2, 2,
+        2, 2
+    }));
+
+    // Batched drain takes runs up to lane weight
+    for (int i = 0; i < 4; ++i)
+    {
+        queue.push_back(0, i);
+        queue.push_back(1, i);
+    }
+
+    lanes.clear();
+
+    ASSERT_EQ(queue.drain([&lanes](std::size_t lane, int) { lanes.push_back(lane); }, 6), 6);
+    ASSERT_EQ(lanes, std::vector<std::size_t>({0, 0, 0, 1, 0, 1}));
+}
+
+TEST(MultiLaneRingbuffer, LaneOverwrite)
+{
+    multi_lane_ringbuffer<int, 2, 2> queue;
+
+    queue.push_back(0, 1);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        queue.push_back(1, i);
+    }
+
+    ASSERT_EQ(queue.lane(0).size(), 1);
+    ASSERT_EQ(queue.lane(1).front(), 3);
+
+    ASSERT_THROW(queue.push_back(2, 0), std::out_of_range);
+    ASSERT_THROW(queue.lane(2), std::out_of_range);
+
+    queue.clear();
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0);
+
+    typedef multi_lane_ringbuffer<int, 2, 2> queue_type;
+
+    ASSERT_THROW(queue_type(ringbuffer_lane_policy::deficit_round_robin, {{1, 0}}), std::invalid_argument);
+}
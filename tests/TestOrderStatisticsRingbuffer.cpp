@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <order_statistics_ringbuffer.hpp>
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+
+TEST(OrderStatisticsRingbuffer, MatchesSortedWindow)
+{
+    order_statistics_ringbuffer<int, 64> buffer;
+    std::deque<int> window;
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> distribution(0, 20);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto value = distribution(random);
+
+        buffer.push_back(value);
+        window.push_back(value);
+
+        if (window.size() > 64)
+        {
+            window.pop_front();
+        }
+
+        if (i % 7 == 0)
+        {
+            std::vector<int> sorted(window.begin(), window.end());
+            std::sort(sorted.begin(), sorted.end());
+
+            ASSERT_EQ(buffer.size(), sorted.size());
+
+            for (std::size_t k = 0; k < sorted.size(); ++k)
+            {
+                ASSERT_EQ(buffer.nth_smallest(k), sorted[k]);
+            }
+
+            auto lower = std::lower_bound(sorted.begin(), sorted.end(), 10);
+            ASSERT_EQ(buffer.rank(10), static_cast<std::size_t>(lower - sorted.begin()));
+
+            ASSERT_EQ(buffer.median(), sorted[(sorted.size() - 1) / 2]);
+        }
+    }
+
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), window.begin()));
+}
+
+TEST(OrderStatisticsRingbuffer, PopFrontAndPercentile)
+{
+    order_statistics_ringbuffer<double, 101> buffer;
+
+    for (int i = 100; i >= 0; --i)
+    {
+        buffer.push_back(i);
+    }
+
+    ASSERT_EQ(buffer.percentile(0.0), 0);
+    ASSERT_EQ(buffer.percentile(0.5), 50);
+    ASSERT_EQ(buffer.percentile(0.99), 99);
+    ASSERT_EQ(buffer.percentile(1.0), 100);
+
+    // Removing 100..51
+    for (int i = 0; i < 50; ++i)
+    {
+        buffer.pop_front();
+    }
+
+    ASSERT_EQ(buffer.percentile(1.0), 50);
+    ASSERT_EQ(buffer.median(), 25);
+    ASSERT_EQ(buffer.rank(25.5), 26);
+
+    buffer.clear();
+
+    ASSERT_THROW(buffer.median(), std::out_of_range);
+    ASSERT_THROW(buffer.pop_front(), std::overflow_error);
+}
+
+TEST(OrderStatisticsRingbuffer, CustomCompare)
+{
+    order_statistics_ringbuffer<int, 8, std::greater<int>> buffer;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    // Window 12..19, ordered descending
+    ASSERT_EQ(buffer.nth_smallest(0), 19);
+    ASSERT_EQ(buffer.nth_smallest(7), 12);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <ringbuffer_io.hpp>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+
+class RingbufferIO : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(pipe(m_pipe), 0);
+    }
+
+    void TearDown() override
+    {
+        close(m_pipe[0]);
+        close(m_pipe[1]);
+    }
+
+    std::string read_pipe(std::size_t count)
+    {
+        std::string result(count, '\0');
+
+        EXPECT_EQ(read(m_pipe[0], &result[0], count), static_cast<ssize_t>(count));
+
+        return result;
+    }
+
+    int m_pipe[2];
+};
+
+TEST_F(RingbufferIO, WriteWrappedSegments)
+{
+    ringbuffer<char, 8> buffer;
+
+    for (char c : std::string("xxxxxabcdefgh"))
+    {
+        buffer.push_back(c);
+    }
+
+    // Only last 8 are kept, so data wraps
+    ASSERT_EQ(buffer.first_segment().size, 3);
+    ASSERT_EQ(buffer.second_segment().size, 5);
+    ASSERT_EQ(ringbuffer_write_to(m_pipe[1], buffer), 8);
+    ASSERT_TRUE(buffer.empty());
+
+    ASSERT_EQ(read_pipe(8), "abcdefgh");
+}
+
+TEST_F(RingbufferIO, ReadIntoFreeSegments)
+{
+    ringbuffer<char, 8> buffer;
+
+    for (char c : std::string("123456"))
+    {
+        buffer.push_back(c);
+    }
+
+    buffer.pop_front(5);
+
+    ASSERT_EQ(write(m_pipe[1], "abcdefgh", 8), 8);
+
+    // Only 7 bytes of free space, split in two segments
+    ASSERT_EQ(ringbuffer_read_from(m_pipe[0], buffer), 7);
+    ASSERT_EQ(buffer.size(), 8);
+    ASSERT_EQ(std::string(buffer.begin(), buffer.end()), "6abcdefg");
+
+    // Full ringbuffer doesn't read
+    ASSERT_EQ(ringbuffer_read_from(m_pipe[0], buffer), 0);
+
+    buffer.pop_front(4);
+
+    // Partial read, just one byte is available
+    ASSERT_EQ(ringbuffer_read_from(m_pipe[0], buffer), 1);
+    ASSERT_EQ(std::string(buffer.begin(), buffer.end()), "defgh");
+}
+
+TEST_F(RingbufferIO, PartialWrite)
+{
+    ringbuffer<char, 4096> buffer;
+
+    ASSERT_EQ(fcntl(m_pipe[1], F_SETFL, O_NONBLOCK), 0);
+
+    std::size_t written = 0;
+
+    // Filling pipe until it refuses writes
+    while (true)
+    {
+        for (std::size_t i = buffer.size(); i < buffer.max_size(); ++i)
+        {
+            buffer.push_back('z');
+        }
+
+        auto result = ringbuffer_write_to(m_pipe[1], buffer);
+
+        if (result < 0)
+        {
+            break;
+        }
+
+        written += static_cast<std::size_t>(result);
+
+        ASSERT_EQ(buffer.size(), buffer.max_size() - result);
+    }
+
+    ASSERT_GT(written, 0);
+}
+
+TEST(RingbufferFileIO, TemporaryFile)
+{
+    char path[] = "/tmp/ringbuffer_io_XXXXXX";
+    int fd = mkstemp(path);
+
+    ASSERT_GE(fd, 0);
+    unlink(path);
+
+    ringbuffer<unsigned char, 16> buffer;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        buffer.push_back(static_cast<unsigned char>(i));
+    }
+
+    ASSERT_EQ(ringbuffer_write_to(fd, buffer), 16);
+    ASSERT_EQ(lseek(fd, 0, SEEK_SET), 0);
+
+    buffer.push_back(100);
+    buffer.pop_front();
+
+    ASSERT_EQ(ringbuffer_read_from(fd, buffer), 16);
+    ASSERT_EQ(ringbuffer_read_from(fd, buffer), 0);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        ASSERT_EQ(buffer[i], i + 4);
+    }
+
+    close(fd);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <ringbuffer_parallel.hpp>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+TEST(RingbufferParallel, Chunks)
+{
+    ringbuffer<std::uint32_t, 1000> buffer;
+
+    for (std::uint32_t i = 0; i < 1300; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    auto span = buffer.view();
+
+    ASSERT_NE(span.second_segment().size, 0);
+
+    auto chunks = ringbuffer_detail::parallel_chunks(span, 100, buffer.slot_index(0));
+
+    // Wrapped span gives same first slot
+    ASSERT_EQ(ringbuffer_detail::span_first_slot(span), buffer.slot_index(0));
+    ASSERT_EQ(ringbuffer_detail::parallel_chunks(span, 100).size(), chunks.size());
+
+    std::vector<std::uint32_t> values;
+    std::size_t offset = 0;
+
+    for (auto&& chunk : chunks)
+    {
+        ASSERT_NE(chunk.size(), 0);
+        ASSERT_LE(chunk.size(), 2 * 112);
+
+        // Inner boundaries start on cache lines of storage slots
+        if (offset != 0)
+        {
+            ASSERT_EQ(buffer.slot_index(offset) % 16, 0);
+        }
+
+        offset += chunk.size();
+
+        chunk.for_each([&values](std::uint32_t el) { values.push_back(el); });
+    }
+
+    std::vector<std::uint32_t> expected(1000);
+    std::iota(expected.begin(), expected.end(), 300);
+
+    ASSERT_EQ(values, expected);
+
+    ASSERT_TRUE(ringbuffer_detail::parallel_chunks(ringbuffer_span<int>(), 100).empty());
+}
+
+TEST(RingbufferParallel, ForEach)
+{
+    ringbuffer<int, 1 << 12> buffer;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    ringbuffer_parallel_pool pool(4);
+
+    ASSERT_EQ(pool.thread_count(), 4);
+
+    parallel_for_each(buffer, [](int& el) { el *= 2; }, pool, 64);
+
+    for (std::size_t i = 0; i < buffer.size(); ++i)
+    {
+        ASSERT_EQ(buffer[i], 2 * static_cast<int>(i + 5000 - 4096));
+    }
+}
+
+TEST(RingbufferParallel, Reduce)
+{
+    ringbuffer<double, 1 << 12> buffer;
+
+    for (int i = 0; i < 6000; ++i)
+    {
+        buffer.push_back(1.0 / (i + 1));
+    }
+
+    auto reduce = [](double sum, double el) { return sum + el; };
+
+    ringbuffer_parallel_pool single(1);
+    ringbuffer_parallel_pool pool(3);
+
+    auto expected = parallel_reduce(buffer, 0.0, reduce, reduce, single, 100);
+
+    // Result doesn't depend on number of threads
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(parallel_reduce(buffer, 0.0, reduce, reduce, pool, 100), expected);
+    }
+
+    ASSERT_NEAR(expected, std::accumulate(buffer.begin(), buffer.end(), 0.0), 1e-9);
+
+    auto count = parallel_reduce(buffer.view(), std::size_t(0),
+                                 [](std::size_t count, double el) { return count + (el > 0.0005 ? 1 : 0); },
+                                 [](std::size_t a, std::size_t b) { return a + b; });
+
+    ASSERT_EQ(count, 1999 - (6000 - 4096));
+
+#if defined(RINGBUFFER_USE_EXECUTION)
+    ASSERT_EQ(parallel_reduce(std::execution::seq, buffer.view(), 0.0, reduce, reduce, 100), expected);
+#endif
+}
+
+TEST(RingbufferParallel, NestedRun)
+{
+    ringbuffer_parallel_pool pool(2);
+
+    std::vector<int> counts(8, 0);
+
+    // Inner runs are executed inline instead of waiting
+    // for busy workers
+    pool.run(8, [&pool, &counts](std::size_t outer)
+    {
+        pool.run(10, [&counts, outer](std::size_t) { ++counts[outer]; });
+    });
+
+    ASSERT_EQ(counts, std::vector<int>(8, 10));
+}
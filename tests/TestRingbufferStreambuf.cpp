@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <ringbuffer_streambuf.hpp>
+#include <istream>
+#include <ostream>
+#include <string>
+
+TEST(RingbufferStreambuf, WriteRead)
+{
+    ringbuffer<char, 64> buffer;
+    ringbuf_streambuf<64> streambuf(buffer);
+
+    std::ostream output(&streambuf);
+    std::istream input(&streambuf);
+
+    output << "value=" << 42 << ' ' << 1.5 << std::flush;
+
+    ASSERT_EQ(buffer.size(), 12);
+    ASSERT_EQ(std::string(buffer.begin(), buffer.end()), "value=42 1.5");
+
+    std::string key;
+    int value = 0;
+    double fraction = 0;
+
+    std::getline(input, key, '=');
+    input >> value >> fraction;
+
+    ASSERT_EQ(key, "value");
+    ASSERT_EQ(value, 42);
+    ASSERT_EQ(fraction, 1.5);
+
+    streambuf.pubsync();
+
+    ASSERT_TRUE(buffer.empty());
+}
+
+TEST(RingbufferStreambuf, WrapAround)
+{
+    ringbuffer<char, 16> buffer;
+    ringbuf_streambuf<16> streambuf(buffer);
+
+    std::ostream output(&streambuf);
+    std::istream input(&streambuf);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        output << "line " << i << '\n' << std::flush;
+
+        std::string line;
+        std::getline(input, line);
+
+        ASSERT_EQ(line, "line " + std::to_string(i));
+    }
+
+    ASSERT_TRUE(streambuf.buffer().empty());
+}
+
+TEST(RingbufferStreambuf, Full)
+{
+    ringbuffer<char, 8> buffer;
+    ringbuf_streambuf<8> streambuf(buffer);
+
+    std::ostream output(&streambuf);
+
+    output << "12345678";
+    ASSERT_TRUE(output.good());
+
+    output << '9';
+    ASSERT_TRUE(output.bad());
+
+    ASSERT_EQ(std::string(streambuf.buffer().begin(), streambuf.buffer().end()), "12345678");
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <ringbuffer_trace.hpp>
+#include <segmented_ringbuffer.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+TEST(RingbufferTrace, Record)
+{
+    ringbuffer_trace trace;
+    recording_ringbuffer<int, 8> buffer(trace);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    buffer.pop_front();
+    buffer.pop_front(2);
+
+    int sum = 0;
+
+    buffer.for_each([&sum](int el) { sum += el; });
+
+    ASSERT_EQ(sum, 7);
+
+    buffer.clear();
+
+    ASSERT_EQ(trace.size(), 9);
+
+    auto events = trace.events();
+
+    ASSERT_EQ(events.size(), 9);
+    ASSERT_EQ(events[0].op, ringbuffer_trace_op::push);
+    ASSERT_EQ(events[5].op, ringbuffer_trace_op::pop);
+    ASSERT_EQ(events[5].count, 1);
+    ASSERT_EQ(events[6].op, ringbuffer_trace_op::pop);
+    ASSERT_EQ(events[6].count, 2);
+    ASSERT_EQ(events[7].op, ringbuffer_trace_op::iterate);
+    ASSERT_EQ(events[7].count, 2);
+    ASSERT_EQ(events[8].op, ringbuffer_trace_op::clear);
+
+    for (std::size_t i = 1; i < events.size(); ++i)
+    {
+        ASSERT_LE(events[i - 1].timestamp, events[i].timestamp);
+    }
+}
+
+TEST(RingbufferTrace, SaveLoad)
+{
+    ringbuffer_trace trace;
+
+    trace.record(ringbuffer_trace_op::push, 1, 10);
+    trace.record(ringbuffer_trace_op::push, 300, 1000000);
+    trace.record(ringbuffer_trace_op::pop, 100, 1000000);
+    trace.record(ringbuffer_trace_op::iterate, 201, 5000000000ull);
+
+    // Varints: 1 + 1 + 1, 1 + 3 + 2, 1 + 1 + 1 and 1 + 5 + 2 bytes
+    ASSERT_EQ(trace.byte_size(), 20);
+
+    std::stringstream stream;
+
+    trace.save(stream);
+
+    auto loaded = ringbuffer_trace::load(stream);
+    auto events = loaded.events();
+
+    ASSERT_EQ(loaded.size(), 4);
+    ASSERT_EQ(events[0].timestamp, 10);
+    ASSERT_EQ(events[1].count, 300);
+    ASSERT_EQ(events[2].op, ringbuffer_trace_op::pop);
+    ASSERT_EQ(events[3].timestamp, 5000000000ull);
+
+    // Recording continues after last loaded timestamp
+    loaded.record(ringbuffer_trace_op::clear, 1, 6000000000ull);
+
+    ASSERT_EQ(loaded.events().back().timestamp, 6000000000ull);
+
+    std::stringstream broken("not a trace");
+
+    ASSERT_THROW(ringbuffer_trace::load(broken), std::runtime_error);
+}
+
+TEST(RingbufferTrace, Replay)
+{
+    ringbuffer_trace trace;
+
+    trace.record(ringbuffer_trace_op::push, 10, 0);
+    trace.record(ringbuffer_trace_op::pop, 3, 1000);
+    trace.record(ringbuffer_trace_op::iterate, 7, 2000);
+    trace.record(ringbuffer_trace_op::pop, 1, 3000);
+
+    auto events = trace.events();
+
+    ringbuffer<int, 16> buffer;
+    std::size_t visited = 0;
+
+    ringbuffer_trace_replay(events, buffer, 1, [&visited](int) { ++visited; });
+
+    ASSERT_EQ(buffer.size(), 6);
+    ASSERT_EQ(visited, 7);
+
+    // Segmented variant, traversed by segments
+    segmented_ringbuffer<int, 4> segmented;
+
+    visited = 0;
+
+    ringbuffer_trace_replay(events, segmented, 1, [&visited](int) { ++visited; }, true);
+
+    ASSERT_EQ(segmented.size(), 6);
+    ASSERT_EQ(visited, 7);
+
+    // Smaller ringbuffer overwrites, pops are clamped
+    ringbuffer<int, 2> small;
+
+    ringbuffer_trace_replay(events, small, 1, [](int) {});
+
+    ASSERT_TRUE(small.empty());
+}
@@ -0,0 +1,23 @@
+#include <gtest/gtest.h>
+#include <ringbuffer_trace.hpp>
+#include <sstream>
+
+// Second translation unit with ringbuffer_trace.hpp
+// (first one is TestRingbufferTrace.cpp), so test
+// executable fails to link, if header defines
+// non-inline entities.
+
+TEST(RingbufferTrace, SecondTranslationUnit)
+{
+    ringbuffer_trace trace;
+
+    trace.record(ringbuffer_trace_op::push, 3, 10);
+
+    std::stringstream stream;
+    trace.save(stream);
+
+    auto loaded = ringbuffer_trace::load(stream);
+
+    ASSERT_EQ(loaded.size(), 1);
+    ASSERT_EQ(loaded.events()[0].count, 3);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <ringbuffer.hpp>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+
+// Elements 0..12, wrapped around storage end
+static void fill_wrapped(ringbuffer<int, 16>& buffer)
+{
+    for (int i = 0; i < 10; ++i)
+    {
+        buffer.push_back(-1);
+        buffer.pop_front();
+    }
+
+    for (int i = 0; i < 13; ++i)
+    {
+        buffer.push_back(i);
+    }
+}
+
+TEST(RingbufferView, TailAndWindow)
+{
+    ringbuffer<int, 16> buffer;
+    fill_wrapped(buffer);
+
+    auto tail = buffer.tail(4);
+
+    ASSERT_EQ(std::vector<int>(tail.begin(), tail.end()), std::vector<int>({9, 10, 11, 12}));
+    ASSERT_EQ(buffer.tail(100).size(), 13);
+
+    auto window = buffer.window(4, 5);
+
+    ASSERT_EQ(std::vector<int>(window.begin(), window.end()), std::vector<int>({4, 5, 6, 7, 8}));
+    ASSERT_EQ(window.first_segment().size + window.second_segment().size, 5);
+    ASSERT_THROW(buffer.window(10, 4), std::out_of_range);
+
+    // Views are not copies
+    window[0] = 40;
+    ASSERT_EQ(buffer[4], 40);
+
+    int sum = 0;
+    window.for_each([&sum](int el) { sum += el; });
+    ASSERT_EQ(sum, 40 + 5 + 6 + 7 + 8);
+
+    const auto& constBuffer = buffer;
+    ringbuffer_span<const int> readOnly = buffer.view();
+
+    ASSERT_EQ(readOnly.size(), constBuffer.view().size());
+    ASSERT_EQ(std::accumulate(readOnly.begin(), readOnly.end(), 0), std::accumulate(buffer.begin(), buffer.end(), 0));
+}
+
+TEST(RingbufferView, Stride)
+{
+    ringbuffer<int, 16> buffer;
+    fill_wrapped(buffer);
+
+    for (std::size_t step = 1; step < 15; ++step)
+    {
+        std::vector<int> expected;
+
+        for (std::size_t i = 0; i < buffer.size(); i += step)
+        {
+            expected.push_back(buffer[i]);
+        }
+
+        auto stride = buffer.stride(step);
+
+        std::vector<int> iterated(stride.begin(), stride.end());
+        std::vector<int> traversed;
+        stride.for_each([&traversed](int el) { traversed.push_back(el); });
+
+        ASSERT_EQ(iterated, expected);
+        ASSERT_EQ(traversed, expected);
+        ASSERT_EQ(stride.size(), expected.size());
+    }
+
+    ASSERT_THROW(buffer.stride(0), std::invalid_argument);
+}
+
+TEST(RingbufferView, Chunks)
+{
+    ringbuffer<int, 16> buffer;
+    fill_wrapped(buffer);
+
+    auto chunks = buffer.chunks(5);
+
+    ASSERT_EQ(chunks.size(), 3);
+    ASSERT_EQ(chunks[2].size(), 3);
+
+    std::vector<int> sums;
+
+    for (auto chunk : chunks)
+    {
+        sums.push_back(std::accumulate(chunk.begin(), chunk.end(), 0));
+    }
+
+    ASSERT_EQ(sums, std::vector<int>({0 + 1 + 2 + 3 + 4, 5 + 6 + 7 + 8 + 9, 10 + 11 + 12}));
+}
+
+#if defined(__cpp_lib_ranges)
+static_assert(std::ranges::random_access_range<ringbuffer_span<int>>);
+static_assert(std::ranges::view<ringbuffer_span<int>>);
+static_assert(std::ranges::borrowed_range<ringbuffer_span<const int>>);
+static_assert(std::ranges::view<ringbuffer_stride_view<int>>);
+static_assert(std::ranges::random_access_range<ringbuffer_chunk_view<int>>);
+
+TEST(RingbufferView, Ranges)
+{
+    ringbuffer<int, 16> buffer;
+    fill_wrapped(buffer);
+
+    auto even = buffer.tail(6) | std::views::filter([](int el) { return el % 2 == 0; });
+
+    ASSERT_EQ(std::ranges::distance(even), 3);
+    ASSERT_EQ(*std::ranges::max_element(buffer.stride(3)), 12);
+}
+#endif
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <segmented_ringbuffer.hpp>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(SegmentedRingbuffer, Grow)
+{
+    segmented_ringbuffer<int, 4> buffer;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    ASSERT_EQ(buffer.size(), 10);
+    ASSERT_EQ(buffer.segment_count(), 3);
+    ASSERT_EQ(buffer.front(), 0);
+    ASSERT_EQ(buffer.back(), 9);
+
+    std::vector<int> values;
+
+    buffer.for_each_segment([&values](ringbuffer_span<int> segment)
+    {
+        segment.for_each([&values](int el) { values.push_back(el); });
+    });
+
+    ASSERT_EQ(values, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    ASSERT_EQ(buffer.front_segment().size(), 4);
+
+    buffer.pop_front(6);
+
+    ASSERT_EQ(buffer.front(), 6);
+    ASSERT_EQ(buffer.segment_count(), 2);
+    ASSERT_EQ(buffer.free_segment_count(), 1);
+
+    buffer.pop_front();
+    buffer.pop_front();
+    buffer.pop_front();
+    buffer.pop_front();
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.segment_count(), 1);
+    ASSERT_THROW(buffer.pop_front(), std::overflow_error);
+    ASSERT_THROW(buffer.front(), std::overflow_error);
+    ASSERT_THROW(buffer.back(), std::overflow_error);
+}
+
+TEST(SegmentedRingbuffer, EmptyAccess)
+{
+    segmented_ringbuffer<int, 4> buffer;
+
+    ASSERT_THROW(buffer.front(), std::overflow_error);
+    ASSERT_THROW(buffer.back(), std::overflow_error);
+
+    const auto& constBuffer = buffer;
+
+    ASSERT_THROW(constBuffer.front(), std::overflow_error);
+    ASSERT_THROW(constBuffer.back(), std::overflow_error);
+}
+
+TEST(SegmentedRingbuffer, SegmentsAreReused)
+{
+    segmented_ringbuffer<std::string, 8> buffer(2);
+
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int i = 0; i < 40; ++i)
+        {
+            buffer.emplace_back(std::to_string(i));
+        }
+
+        ASSERT_EQ(buffer.segment_count(), 5);
+
+        for (int i = 0; i < 40; ++i)
+        {
+            ASSERT_EQ(buffer.front(), std::to_string(i));
+            buffer.pop_front();
+        }
+
+        // Only limited number of drained segments is kept
+        ASSERT_EQ(buffer.free_segment_count(), 2);
+    }
+
+    buffer.push_back("a");
+    buffer.clear();
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.segment_count(), 0);
+}
+
+TEST(SegmentedRingbuffer, MatchesDeque)
+{
+    segmented_ringbuffer<int, 16> buffer;
+    std::deque<int> expected;
+    std::mt19937 random(7);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        if (random() % 3 != 0 || expected.empty())
+        {
+            buffer.push_back(i);
+            expected.push_back(i);
+        }
+        else
+        {
+            ASSERT_EQ(buffer.front(), expected.front());
+            buffer.pop_front();
+            expected.pop_front();
+        }
+
+        ASSERT_EQ(buffer.size(), expected.size());
+    }
+}
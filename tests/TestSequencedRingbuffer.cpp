@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <sequenced_ringbuffer.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+TEST(SequencedRingbuffer, Sequences)
+{
+    sequenced_ringbuffer<int, 4> buffer;
+
+    ASSERT_EQ(buffer.first_seq(), 0);
+    ASSERT_EQ(buffer.next_seq(), 0);
+    ASSERT_THROW(buffer.last_seq(), std::overflow_error);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        ASSERT_EQ(buffer.push_back(i * 10), i);
+    }
+
+    // 0 and 1 are overwritten
+    ASSERT_EQ(buffer.first_seq(), 2);
+    ASSERT_EQ(buffer.last_seq(), 5);
+    ASSERT_EQ(buffer.next_seq(), 6);
+
+    ASSERT_EQ(buffer.at_seq(2), 20);
+    ASSERT_EQ(buffer.at_seq(5), 50);
+    ASSERT_EQ(buffer.at_seq(4), buffer[2]);
+
+    ASSERT_FALSE(buffer.contains_seq(1));
+    ASSERT_TRUE(buffer.contains_seq(3));
+    ASSERT_THROW(buffer.at_seq(1), std::out_of_range);
+    ASSERT_THROW(buffer.at_seq(6), std::out_of_range);
+
+    buffer.at_seq(3) = 31;
+    ASSERT_EQ(buffer[1], 31);
+
+    buffer.pop_front();
+    ASSERT_EQ(buffer.first_seq(), 3);
+    ASSERT_EQ(buffer.front(), 31);
+
+    // Numbering continues after clear
+    buffer.clear();
+    ASSERT_EQ(buffer.first_seq(), 6);
+    ASSERT_EQ(buffer.emplace_back(60), 6);
+    ASSERT_EQ(buffer.at_seq(6), 60);
+
+    sequenced_ringbuffer<int, 4> restarted(std::uint64_t(1) << 40);
+
+    ASSERT_EQ(restarted.push_back(1), std::uint64_t(1) << 40);
+    ASSERT_EQ(restarted.first_seq(), std::uint64_t(1) << 40);
+}
+
+TEST(SequencedRingbuffer, CursorResume)
+{
+    sequenced_ringbuffer<int, 4> buffer;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    std::vector<std::uint64_t> sequences;
+    std::vector<int> values;
+
+    auto collect = [&](std::uint64_t sequence, int value)
+    {
+        sequences.push_back(sequence);
+        values.push_back(value);
+    };
+
+    auto cursor = buffer.resume(1);
+    auto result = buffer.read(cursor, collect);
+
+    ASSERT_EQ(result.missed, 0);
+    ASSERT_EQ(result.read, 2);
+    ASSERT_EQ(cursor.sequence(), 3);
+    ASSERT_EQ(values, std::vector<int>({1, 2}));
+
+    // Nothing new
+    result = buffer.read(cursor, collect);
+    ASSERT_EQ(result.missed, 0);
+    ASSERT_EQ(result.read, 0);
+
+    // Consumer was away, while 3..8 were pushed,
+    // 3 and 4 are already overwritten
+    for (int i = 3; i < 9; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    sequences.clear();
+    values.clear();
+
+    result = buffer.read(cursor, collect, 3);
+
+    ASSERT_EQ(result.missed, 2);
+    ASSERT_EQ(result.read, 3);
+    ASSERT_EQ(sequences, std::vector<std::uint64_t>({5, 6, 7}));
+    ASSERT_EQ(values, std::vector<int>({5, 6, 7}));
+
+    result = buffer.read(cursor, collect);
+
+    ASSERT_EQ(result.missed, 0);
+    ASSERT_EQ(result.read, 1);
+    ASSERT_EQ(cursor.sequence(), 9);
+
+    // Cursor ahead of producer waits for it
+    auto ahead = buffer.resume(11);
+
+    ASSERT_EQ(buffer.read(ahead, collect).read, 0);
+    ASSERT_EQ(ahead.sequence(), 11);
+
+    auto tail = buffer.tail_cursor();
+    buffer.push_back(9);
+
+    values.clear();
+    ASSERT_EQ(buffer.read(tail, collect).read, 1);
+    ASSERT_EQ(values, std::vector<int>({9}));
+}
+
+TEST(SequencedRingbuffer, ViewFrom)
+{
+    sequenced_ringbuffer<int, 4> buffer;
+
+    for (int i = 0; i < 7; ++i)
+    {
+        buffer.push_back(i);
+    }
+
+    std::vector<int> values;
+    buffer.view_from(5).for_each([&values](int el) { values.push_back(el); });
+
+    ASSERT_EQ(values, std::vector<int>({5, 6}));
+
+    // Overwritten part is skipped
+    ASSERT_EQ(buffer.view_from(0).size(), 4);
+    ASSERT_EQ(buffer.view_from(7).size(), 0);
+    ASSERT_EQ(buffer.view_from(100).size(), 0);
+}
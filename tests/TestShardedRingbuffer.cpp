@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+#include <sharded_ringbuffer.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+struct TraceEvent
+{
+    uint32_t thread;
+    uint32_t sequence;
+    uint64_t timestamp;
+};
+
+TEST(SpscRingbuffer, PushPop)
+{
+    spsc_ringbuffer<int, 4> buffer;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(buffer.push(i));
+    }
+
+    ASSERT_FALSE(buffer.push(4));
+    ASSERT_EQ(buffer.size(), 4);
+
+    int value = -1;
+    ASSERT_TRUE(buffer.pop(value));
+    ASSERT_EQ(value, 0);
+
+    ASSERT_TRUE(buffer.emplace(4));
+
+    std::vector<int> consumed;
+    ASSERT_EQ(buffer.consume([&consumed](int& el) { consumed.push_back(el); }), 4);
+    ASSERT_EQ(consumed, std::vector<int>({1, 2, 3, 4}));
+    ASSERT_FALSE(buffer.pop(value));
+}
+
+TEST(SpscRingbuffer, ReserveCommit)
+{
+    spsc_ringbuffer<int, 8> buffer;
+
+    auto slots = buffer.reserve(5);
+
+    ASSERT_EQ(slots.size(), 5);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        slots[i] = i;
+    }
+
+    // Nothing is visible before commit
+    ASSERT_EQ(buffer.front(), nullptr);
+
+    buffer.commit(5);
+
+    ASSERT_EQ(buffer.consume([](int&) {}, 3), 3);
+
+    slots = buffer.reserve(10);
+
+    ASSERT_EQ(slots.size(), 6);
+    ASSERT_EQ(slots.second_segment().size, 3);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        slots[i] = 5 + i;
+    }
+
+    buffer.commit(6);
+
+    std::vector<int> consumed;
+    buffer.consume([&consumed](int& el) { consumed.push_back(el); });
+
+    ASSERT_EQ(consumed, std::vector<int>({3, 4, 5, 6, 7, 8, 9, 10}));
+    ASSERT_THROW(buffer.commit(9), std::overflow_error);
+}
+
+TEST(ShardedRingbuffer, ConcurrentWritersAndCollector)
+{
+    constexpr uint32_t Threads = 4;
+    constexpr uint32_t Count = 20000;
+
+    sharded_ringbuffer<TraceEvent, 256> collector;
+    std::atomic<uint64_t> clock(0);
+    std::atomic<uint32_t> finished(0);
+
+    std::vector<std::thread> writers;
+
+    for (uint32_t thread = 0; thread < Threads; ++thread)
+    {
+        writers.emplace_back([&, thread]()
+        {
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                TraceEvent event{thread, i, ++clock};
+
+                while (!collector.push_back(event))
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            ++finished;
+        });
+    }
+
+    std::vector<uint32_t> expected(Threads, 0);
+    std::size_t total = 0;
+
+    auto check = [&](TraceEvent& event)
+    {
+        // Per thread order is kept
+        ASSERT_EQ(event.sequence, expected[event.thread]);
+        ++expected[event.thread];
+        ++total;
+    };
+
+    while (finished != Threads)
+    {
+        collector.drain(check, 64);
+    }
+
+    collector.drain(check);
+
+    for (auto&& writer : writers)
+    {
+        writer.join();
+    }
+
+    ASSERT_EQ(total, Threads * Count);
+    ASSERT_EQ(collector.shard_count(), Threads);
+    ASSERT_GT(collector.dropped(), 0u);
+}
+
+TEST(ShardedRingbuffer, DrainOrdered)
+{
+    sharded_ringbuffer<TraceEvent, 1024> collector;
+    std::atomic<uint64_t> clock(0);
+
+    std::vector<std::thread> writers;
+
+    for (uint32_t thread = 0; thread < 3; ++thread)
+    {
+        writers.emplace_back([&, thread]()
+        {
+            for (uint32_t i = 0; i < 300; ++i)
+            {
+                collector.push_back(TraceEvent{thread, i, ++clock});
+            }
+        });
+    }
+
+    for (auto&& writer : writers)
+    {
+        writer.join();
+    }
+
+    uint64_t previous = 0;
+
+    auto drained = collector.drain_ordered(
+        [&previous](TraceEvent& event)
+        {
+            ASSERT_GT(event.timestamp, previous);
+            previous = event.timestamp;
+        },
+        [](const TraceEvent& event) { return event.timestamp; }
+    );
+
+    ASSERT_EQ(drained, 900);
+    ASSERT_EQ(previous, 900);
+}
+
+TEST(ShardedRingbuffer, ShardReuse)
+{
+    sharded_ringbuffer<int, 16> collector;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        std::thread([&collector, i]() { collector.push_back(i); }).join();
+    }
+
+    ASSERT_EQ(collector.shard_count(), 1);
+
+    std::vector<int> values;
+    collector.drain([&values](int value) { values.push_back(value); });
+
+    ASSERT_EQ(values, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+/**
+ * @brief Functor, that numbers values in order
+ * of calls, so it must be called as one object.
+ */
+struct NumberingFunctor
+{
+    void operator()(int)
+    {
+        numbers->push_back(next++);
+    }
+
+    std::vector<int>* numbers;
+    int next;
+};
+
+TEST(ShardedRingbuffer, DrainKeepsFunctorState)
+{
+    sharded_ringbuffer<int, 16> collector;
+
+    // Every thread lives while others push,
+    // so each one gets own shard
+    std::atomic<int> pushed(0);
+    std::vector<std::thread> writers;
+
+    for (int thread = 0; thread < 3; ++thread)
+    {
+        writers.emplace_back([&collector, &pushed]()
+        {
+            collector.push_back(1);
+            collector.push_back(2);
+            ++pushed;
+
+            while (pushed.load() != 3)
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (auto&& writer : writers)
+    {
+        writer.join();
+    }
+
+    ASSERT_EQ(collector.shard_count(), 3);
+
+    std::vector<int> numbers;
+
+    ASSERT_EQ(collector.drain(NumberingFunctor{&numbers, 0}), 6);
+    ASSERT_EQ(numbers, std::vector<int>({0, 1, 2, 3, 4, 5}));
+}
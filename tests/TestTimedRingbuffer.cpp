@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <timed_ringbuffer.hpp>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+struct ManualClock
+{
+    static std::uint64_t now()
+    {
+        return value;
+    }
+
+    static std::uint64_t value;
+};
+
+std::uint64_t ManualClock::value = 0;
+
+TEST(DwellTimeHistogram, Buckets)
+{
+    for (std::uint64_t value = 0; value < 8; ++value)
+    {
+        ASSERT_EQ(dwell_time_histogram::bucket_of(value), value);
+        ASSERT_EQ(dwell_time_histogram::upper_bound(value), value);
+    }
+
+    ASSERT_EQ(dwell_time_histogram::bucket_of(8), 8);
+    ASSERT_EQ(dwell_time_histogram::bucket_of(15), 15);
+    ASSERT_EQ(dwell_time_histogram::bucket_of(16), 16);
+    ASSERT_EQ(dwell_time_histogram::bucket_of(17), 16);
+    ASSERT_EQ(dwell_time_histogram::upper_bound(16), 17);
+    ASSERT_EQ(dwell_time_histogram::bucket_of(UINT64_MAX), dwell_time_histogram::BucketCount - 1);
+    ASSERT_EQ(dwell_time_histogram::upper_bound(dwell_time_histogram::BucketCount - 1), UINT64_MAX);
+
+    // Every value lies within its bucket
+    for (std::uint64_t value = 1; value < (1ull << 40); value = value * 3 + 1)
+    {
+        auto bucket = dwell_time_histogram::bucket_of(value);
+
+        ASSERT_LE(value, dwell_time_histogram::upper_bound(bucket));
+        ASSERT_GT(value, dwell_time_histogram::upper_bound(bucket - 1));
+    }
+}
+
+TEST(DwellTimeHistogram, Percentiles)
+{
+    dwell_time_histogram histogram;
+
+    ASSERT_EQ(histogram.percentile(0.5), 0);
+
+    for (std::uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.record(value);
+    }
+
+    ASSERT_EQ(histogram.count(), 1000);
+    ASSERT_EQ(histogram.max(), 1000);
+    ASSERT_DOUBLE_EQ(histogram.mean(), 500.5);
+
+    // Log-linear buckets give at most 12.5% error
+    ASSERT_NEAR(histogram.percentile(0.5), 500, 500 / 8);
+    ASSERT_NEAR(histogram.percentile(0.99), 990, 990 / 8);
+    ASSERT_EQ(histogram.percentile(1.0), 1000);
+
+    std::ostringstream stream;
+    stream << histogram;
+
+    ASSERT_EQ(stream.str().find("count=1000"), 0);
+
+    histogram.reset();
+
+    ASSERT_EQ(histogram.count(), 0);
+    ASSERT_EQ(histogram.max(), 0);
+}
+
+TEST(DwellTimeHistogram, ConcurrentRecord)
+{
+    dwell_time_histogram histogram;
+
+    std::vector<std::thread> threads;
+
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&histogram, thread]()
+        {
+            for (std::uint64_t i = 0; i < 10000; ++i)
+            {
+                histogram.record(i + thread);
+            }
+        });
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(histogram.count(), 40000);
+    ASSERT_EQ(histogram.max(), 10002);
+}
+
+TEST(TimedRingbuffer, DwellTime)
+{
+    ManualClock::value = 100;
+
+    timed_ringbuffer<int, 4, ManualClock> buffer;
+
+    buffer.push_back(1);
+
+    ManualClock::value = 105;
+    buffer.push_back(2);
+    buffer.emplace_back(3);
+
+    ManualClock::value = 110;
+    ASSERT_EQ(buffer.front_age(), 10);
+
+    buffer.pop_front();
+
+    ASSERT_EQ(buffer.front(), 2);
+    ASSERT_EQ(buffer.histogram().count(), 1);
+    ASSERT_EQ(buffer.histogram().max(), 10);
+
+    ManualClock::value = 125;
+    buffer.pop_front(2);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.histogram().count(), 3);
+    ASSERT_EQ(buffer.histogram().max(), 20);
+    ASSERT_EQ(buffer.histogram().percentile(0.5), 20);
+    ASSERT_THROW(buffer.pop_front(), std::overflow_error);
+}
+
+TEST(TimedRingbuffer, Overwrite)
+{
+    ManualClock::value = 0;
+
+    timed_ringbuffer<int, 3, ManualClock> buffer;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        ManualClock::value = i * 10;
+        buffer.push_back(i);
+    }
+
+    ASSERT_EQ(buffer.overwritten(), 2);
+    ASSERT_EQ(buffer.front(), 2);
+
+    ManualClock::value = 100;
+
+    // Elements 2, 3, 4 were pushed at 20, 30, 40
+    buffer.pop_front();
+    ASSERT_EQ(buffer.histogram().max(), 80);
+
+    buffer.pop_front();
+    buffer.pop_front();
+
+    ASSERT_EQ(buffer.histogram().count(), 3);
+    // 60 falls into [56, 63] bucket
+    ASSERT_EQ(buffer.histogram().percentile(0.0), 63);
+}
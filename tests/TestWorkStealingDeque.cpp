@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <work_stealing_deque.hpp>
+#include <thread>
+
+TEST(WorkStealingDeque, OwnerIsLifoThiefIsFifo)
+{
+    work_stealing_deque<int> deque(4);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        deque.push(i);
+    }
+
+    int value = -1;
+
+    ASSERT_TRUE(deque.pop(value));
+    ASSERT_EQ(value, 3);
+
+    ASSERT_TRUE(deque.steal(value));
+    ASSERT_EQ(value, 0);
+
+    ASSERT_EQ(deque.size(), 2);
+
+    ASSERT_TRUE(deque.pop(value));
+    ASSERT_TRUE(deque.pop(value));
+    ASSERT_EQ(value, 1);
+
+    ASSERT_FALSE(deque.pop(value));
+    ASSERT_FALSE(deque.steal(value));
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDeque, Grow)
+{
+    work_stealing_deque<int> deque(2);
+
+    // Moving top forward, so grown storage is copied across wrap point
+    int value = 0;
+    deque.push(-1);
+    ASSERT_TRUE(deque.steal(value));
+
+    for (int i = 0; i < 100; ++i)
+    {
+        deque.push(i);
+    }
+
+    ASSERT_GE(deque.capacity(), 100);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(deque.steal(value));
+        ASSERT_EQ(value, i);
+    }
+}
+
+TEST(WorkStealingDeque, ConcurrentSteal)
+{
+    constexpr int Count = 100000;
+    constexpr int Thieves = 3;
+
+    work_stealing_deque<int> deque(16);
+
+    std::vector<std::atomic<int>> taken(Count);
+    std::atomic<bool> finished(false);
+
+    for (auto&& flag : taken)
+    {
+        flag = 0;
+    }
+
+    std::vector<std::thread> thieves;
+
+    for (int i = 0; i < Thieves; ++i)
+    {
+        thieves.emplace_back([&]()
+        {
+            int value;
+
+            while (!finished || !deque.empty())
+            {
+                if (deque.steal(value))
+                {
+                    ++taken[value];
+                }
+            }
+        });
+    }
+
+    int value;
+
+    for (int i = 0; i < Count; ++i)
+    {
+        deque.push(i);
+
+        if (i % 3 == 0 && deque.pop(value))
+        {
+            ++taken[value];
+        }
+    }
+
+    while (deque.pop(value))
+    {
+        ++taken[value];
+    }
+
+    finished = true;
+
+    for (auto&& thief : thieves)
+    {
+        thief.join();
+    }
+
+    for (int i = 0; i < Count; ++i)
+    {
+        ASSERT_EQ(taken[i], 1) << "Element " << i;
+    }
+}